@@ -12,7 +12,12 @@
 #include "solvers/graham_scan_2d.h"
 #include "solvers/jarvis_scan_2d.h"
 #include "solvers/jarvis_scan_3d.h"
+#include "solvers/kirkpatrick_seidel_2d.h"
+#include "solvers/divide_conquer_2d.h"
+#include "solvers/randomized_incremental_2d.h"
+#include "solvers/sample_filter_2d.h"
 #include "solvers/monotone_chain_2d.h"
+#include "solvers/ouellet_2d.h"
 #include "solvers/quickhull_2d.h"
 #include "solvers/solver_2d.h"
 
@@ -122,10 +127,15 @@ int main(int argc, char ** argv)
     bool parallelMode = 0;
     int threads = 0;
 
+    // streaming of input by chunks
+    bool streamMode = 0;
+    unsigned chunkSize = 1 << 20;
+    ch::StreamFormat streamFormat = ch::TEXT;
+
     int c, val;
     bool endFlag = 0, wasError = 0, argOK;
     string nxtArg;
-    while ((c = getopt(argc, argv, "i:o:p:s:d:m:t"))) {
+    while ((c = getopt(argc, argv, "i:o:p:s:d:m:tc:b:r"))) {
         switch (c) {
             case 'i':
                 useFileInput = 1;
@@ -199,6 +209,43 @@ int main(int argc, char ** argv)
                 wasError = 1;
                 break;
 
+            case 'c':
+                R("calibration: " << optarg);
+                if (!ch::loadCalibration(optarg)) {
+                    std::cerr << "[ERROR] Cannot load calibration file "
+                        << optarg << std::endl;
+                    endFlag = 1;
+                    wasError = 1;
+                }
+                break;
+
+            case 'b':
+                R("stream mode, chunk " << optarg);
+                streamMode = 1;
+                nxtArg = optarg;
+                chunkSize = 0;
+                argOK = !nxtArg.empty();
+                for (char digit : nxtArg) {
+                    if (!isdigit(digit)) {
+                        argOK = 0;
+                        break;
+                    }
+                    chunkSize = 10 * chunkSize + digit - '0';
+                }
+                if (!argOK || chunkSize < 1) {
+                    std::cerr << "[ERROR] Chunk size has to be positive number"
+                        << std::endl;
+                    endFlag = 1;
+                    wasError = 1;
+                }
+                break;
+
+            case 'r':
+                R("binary stream");
+                streamMode = 1;
+                streamFormat = ch::BINARY;
+                break;
+
             case 't':
                 R("timing enabled");
                 displayTime = 1;
@@ -275,6 +322,18 @@ int main(int argc, char ** argv)
             } else if (usedAlgo == "andrew") {
                 // experimental
                 sType = ch::ANDREW;
+            } else if (usedAlgo == "ouellet") {
+                sType = ch::OUELLET;
+            } else if (usedAlgo == "kirkpatrick") {
+                sType = ch::KIRKPATRICK;
+            } else if (usedAlgo == "divide") {
+                sType = ch::DIVIDE;
+            } else if (usedAlgo == "randomized") {
+                sType = ch::RANDOMIZED;
+            } else if (usedAlgo == "sample") {
+                sType = ch::SAMPLE;
+            } else if (usedAlgo == "auto") {
+                sType = ch::AUTO;
             } else {
                 std::cerr << "[ERROR] Unknown 2D solver type: " << usedAlgo <<
                     std::endl;
@@ -284,6 +343,11 @@ int main(int argc, char ** argv)
 
         if (perfMode) {
             R("Running perftest");
+            if (sType == ch::AUTO) {
+                std::cerr << "[ERROR] Performance testing needs fixed solver"
+                    << std::endl;
+                return 1;
+            }
             if (instance[0] > (1LL << 31)) {
                 std::cerr << "[ERROR] Too large instance" <<  std::endl;
                 return 1;
@@ -311,8 +375,26 @@ int main(int argc, char ** argv)
             return 0;
         }
 
-        ch::Points2D input;
-        if (useFileInput) {
+        ch::Points2D input, output;
+        double timeA = omp_get_wtime();
+        if (streamMode) {
+            // input is never held whole, it is solved while being read
+            std::ifstream ifs;
+            if (useFileInput) {
+                ifs.open(inputFilename, std::ios::binary);
+                if (!ifs.is_open()) {
+                    std::cerr << "[ERROR] Cannot open input file "
+                        << inputFilename << std::endl;
+                    return 1;
+                }
+            }
+            if (!ch::findHullStream(useFileInput ? ifs : std::cin,
+                    streamFormat, output, sType, chunkSize,
+                    parallelMode ? threads : 1)) {
+                std::cerr << "[ERROR] Cannot read point" << std::endl;
+                return 1;
+            }
+        } else if (useFileInput) {
             std::ifstream ifs(inputFilename);
             if (!ifs.is_open()) {
                 std::cerr << "[ERROR] Cannot open input file " << inputFilename 
@@ -329,9 +411,13 @@ int main(int argc, char ** argv)
             }
         }
 
-        ch::Points2D output;
-        double timeA = omp_get_wtime();
-        if (parallelMode) {
+        // streamed input is timed together with reading
+        if (!streamMode) {
+            timeA = omp_get_wtime();
+        }
+        if (streamMode) {
+            R("solved while streaming");
+        } else if (parallelMode) {
             D("parallel " << threads);
             findHullParallel(input, output, sType, threads);
         } else {
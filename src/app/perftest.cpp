@@ -46,6 +46,8 @@ void PerfTest::runAllTests()
     // solvers.push_back(new Chan2D(Chan2D::PARA_ALGO));
     // solvers.push_back(new Chan2D(Chan2D::PARA_COMBO));
 
+    // solvers.push_back(new Ouellet2D());
+
     // run tests
     // smallTests(solvers);
 
@@ -56,6 +58,12 @@ void PerfTest::runAllTests()
     // approximation tests
     // BFP2D bfp; approxTests(bfp);
 
+    // chanStepTests();
+
+    // adversarialTests();
+
+    // testEdges();
+
     // cleanup
     for (auto solver : solvers) {
         delete solver;
@@ -123,6 +131,108 @@ void PerfTest::bigTests(std::vector<Solver2D*> solvers)
     }
 }
 
+void PerfTest::testEdges()
+{
+    for (int n = 10000; n <= 10000000; n *= 10) {
+        findEdge(n);
+    }
+}
+
+void PerfTest::findEdge(int setSize)
+{
+    std::vector<Solver2D*> solvers;
+    solvers.push_back(new JarvisScan2D(JarvisScan2D::CROSS));
+    solvers.push_back(new Quickhull2D());
+    solvers.push_back(new GrahamScan2D());
+    solvers.push_back(new KirkpatrickSeidel2D());
+
+    std::cout << std::fixed << std::setprecision(6);
+    std::cout << "Edges for " << setSize << " pts" << std::endl;
+    Generator2D generator;
+    Solver2D * best = NULL;
+    for (int h = 4; h <= setSize / 2; h *= 2) {
+        Points2D input;
+        generator.genUniformCircle(setSize, h, 1000, input);
+
+        std::cout << std::setw(8) << h << " on hull: ";
+        Solver2D * currBest = NULL;
+        double bestTime = 0;
+        for (auto solver : solvers) {
+            // quadratic in h, skip where hopeless
+            if (solver -> getName() == "Jarvis Scan" && h > 250) {
+                continue;
+            }
+            double time = runGeneratedTest(h, input, *solver);
+            std::cout << time << " ";
+            if (currBest == NULL || time < bestTime) {
+                currBest = solver;
+                bestTime = time;
+            }
+        }
+        std::cout << "- " << currBest -> getName() << std::endl;
+
+        if (best != NULL && best != currBest) {
+            std::cout << "  edge: " << currBest -> getName() << " beats "
+                      << best -> getName() << " at h = " << h << std::endl;
+        }
+        best = currBest;
+    }
+
+    for (auto solver : solvers) {
+        delete solver;
+    }
+}
+
+void PerfTest::chanStepTests()
+{
+    std::vector<Solver2D*> solvers;
+    solvers.push_back(new Chan2D(Chan2D::GRAHAM));
+    solvers.push_back(new JarvisScan2D(JarvisScan2D::CROSS));
+
+    std::cout << std::fixed << std::setprecision(9);
+    Generator2D generator;
+    for (int n = 10000; n <= 10000000; n *= 10) {
+        Points2D input;
+        int h = 1000;
+        generator.genUniformCircle(n, h, 1000, input);
+        std::cout << n << " pts, " << h << " on hull" << std::endl;
+        for (auto solver : solvers) {
+            double time = runGeneratedTest(h, input, *solver);
+            std::cout << std::setw(15) << solver -> getName() << ": "
+                      << time << " s, " << time / h << " s per step"
+                      << std::endl;
+        }
+    }
+
+    for (auto solver : solvers) {
+        delete solver;
+    }
+}
+
+void PerfTest::adversarialTests()
+{
+    std::vector<Solver2D*> solvers;
+    solvers.push_back(new Quickhull2D());
+    solvers.push_back(new RandomizedIncremental2D());
+
+    std::cout << std::fixed << std::setprecision(9);
+    Generator2D generator;
+    for (int n = 10000; n <= 1000000; n *= 10) {
+        Points2D input;
+        generator.genUniformCircle(n, n, 1000, input);
+        std::cout << n << " pts, all on hull" << std::endl;
+        for (auto solver : solvers) {
+            std::cout << std::setw(25) << solver -> getName() << ": "
+                      << runGeneratedTest(n, input, *solver) << " s"
+                      << std::endl;
+        }
+    }
+
+    for (auto solver : solvers) {
+        delete solver;
+    }
+}
+
 double PerfTest::runTest(int n, int h, int span, int runs,
                 int cores, SolverType type)
 {
@@ -144,6 +254,21 @@ double PerfTest::runTest(int n, int h, int span, int runs,
             case ANDREW:
                 solver = new MonotoneChain2D();
                 break;
+            case OUELLET:
+                solver = new Ouellet2D();
+                break;
+            case KIRKPATRICK:
+                solver = new KirkpatrickSeidel2D(KirkpatrickSeidel2D::PARA);
+                break;
+            case DIVIDE:
+                solver = new DivideConquer2D();
+                break;
+            case RANDOMIZED:
+                solver = new RandomizedIncremental2D();
+                break;
+            case SAMPLE:
+                solver = new SampleFilter2D(SampleFilter2D::PARA);
+                break;
             default:
                 solver = new Quickhull2D(Quickhull2D::PARA);
                 break;
@@ -165,6 +290,21 @@ double PerfTest::runTest(int n, int h, int span, int runs,
             case ANDREW:
                 solver = new MonotoneChain2D();
                 break;
+            case OUELLET:
+                solver = new Ouellet2D();
+                break;
+            case KIRKPATRICK:
+                solver = new KirkpatrickSeidel2D();
+                break;
+            case DIVIDE:
+                solver = new DivideConquer2D();
+                break;
+            case RANDOMIZED:
+                solver = new RandomizedIncremental2D();
+                break;
+            case SAMPLE:
+                solver = new SampleFilter2D();
+                break;
             default:
                 solver = new Quickhull2D();
                 break;
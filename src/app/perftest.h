@@ -17,8 +17,13 @@
 #include "solvers/solver_3d.h"
 #include "solvers/jarvis_scan_2d.h"
 #include "solvers/jarvis_scan_3d.h"
+#include "solvers/kirkpatrick_seidel_2d.h"
+#include "solvers/divide_conquer_2d.h"
+#include "solvers/randomized_incremental_2d.h"
+#include "solvers/sample_filter_2d.h"
 #include "solvers/graham_scan_2d.h"
 #include "solvers/monotone_chain_2d.h"
+#include "solvers/ouellet_2d.h"
 #include "solvers/quickhull_2d.h"
 #include "solvers/chan_2d.h"
 
@@ -71,10 +76,28 @@ class PerfTest
         /**
          * Finds point where QH beats JS, and GS beats QH. If that happens.
          *
+         * Kirkpatrick-Seidel is measured along, to find range of h where
+         * output sensitivity pays off.
+         *
          * @param setSize number of points in input set
          */
         void findEdge(int setSize);
 
+        /**
+         * Measures cost of one wrapping step of Chan's algorithm.
+         *
+         * Hull size is fixed while input grows, time per hull point should
+         * grow only logarithmically, compared against Jarvis scan.
+         */
+        void chanStepTests();
+
+        /**
+         * Compares randomized incremental solver against Quickhull on
+         * inputs with all points on hull, where Quickhull recursion does
+         * most work.
+         */
+        void adversarialTests();
+
         /**
          * Runs single instance of test, on group of solvers.
          *
@@ -0,0 +1,221 @@
+#include "approximators/epskernel2d.h"
+
+namespace ch
+{
+
+// last frame is at most twice the diagonal of bounding box, earlier frames
+// at most halve in each step, so their errors sum up to twice the last one
+const double EpsKernel2D::STREAM_SLACK = 4 * sqrt(2);
+
+EpsKernel2D::EpsKernel2D()
+{
+    init(1e-3);
+}
+
+EpsKernel2D::EpsKernel2D(double eps)
+{
+    init(eps);
+}
+
+void EpsKernel2D::init(double eps)
+{
+    name_ = "Eps Kernel";
+    eps_ = eps;
+    maxAnchors_ = fitAnchors(eps / STREAM_SLACK);
+    clear();
+}
+
+Points2D& EpsKernel2D::approximate(const Points2D& input, Points2D& output)
+{
+    clear();
+    const data_t& data = input.getData();
+    if (data.empty()) {
+        return output;
+    }
+
+    // frame known up front never grows, it is centered in bounding box
+    minX_ = maxX_ = data[0][0];
+    minY_ = maxY_ = data[0][1];
+    for (auto& pt : data) {
+        minX_ = std::min(minX_, pt[0]);
+        maxX_ = std::max(maxX_, pt[0]);
+        minY_ = std::min(minY_, pt[1]);
+        maxY_ = std::max(maxY_, pt[1]);
+    }
+    double cx = (minX_ + maxX_) / 2, cy = (minY_ + maxY_) / 2,
+           extent = std::max(maxX_ - minX_, maxY_ - minY_), far = 0;
+    for (auto& pt : data) {
+        far = std::max(far, (pt[0] - cx) * (pt[0] - cx)
+                            + (pt[1] - cy) * (pt[1] - cy));
+    }
+    far = sqrt(far) * (1 + EPS);
+    setFrame(cx, cy, far, far > 0 ? fitAnchors(eps_ * extent / far)
+                                   : fitAnchors(INFINITY));
+    empty_ = false;
+
+    for (auto& pt : data) {
+        add(pt[0], pt[1]);
+    }
+    return getHull(output);
+}
+
+int EpsKernel2D::maxReachable() const
+{
+    return maxAnchors_;
+}
+
+void EpsKernel2D::add(double x, double y)
+{
+    if (hullX_.size() >= 3 && ptInHull(hullX_.data(), hullY_.data(),
+                                         hullX_.size(), x, y)) {
+        return;
+    }
+    addOuter(x, y);
+}
+
+void EpsKernel2D::clear()
+{
+    anchors_.clear();
+    hullX_.clear();
+    hullY_.clear();
+    stale_ = 0;
+    pastError_ = 0;
+    empty_ = true;
+}
+
+Points2D& EpsKernel2D::getHull(Points2D& output) const
+{
+    std::vector<point2d_t> pts, hull(2 * anchors_.size());
+    for (auto& anchor : anchors_) {
+        pts.push_back({anchor.qx, anchor.qy});
+    }
+    unsigned h = SmallHull2D::hull(pts.data(), pts.size(), hull.data());
+    for (unsigned i = 0; i < h; i++) {
+        output.add({hull[i].first, hull[i].second});
+    }
+    return output;
+}
+
+double EpsKernel2D::errorBound() const
+{
+    if (empty_) {
+        return 0;
+    }
+    return pastError_ + frameError(anchors_.size()) * radius_;
+}
+
+unsigned EpsKernel2D::getDirections() const
+{
+    return anchors_.size();
+}
+
+double EpsKernel2D::frameError(unsigned k)
+{
+    // anchors on circle of radius 2 are at most d = 4 s apart, farthest
+    // point lies at least 1 from the circle
+    double s = sin(PI / (2 * k));
+    return 8 * s * s / (1 - 4 * s);
+}
+
+unsigned EpsKernel2D::fitAnchors(double ratio)
+{
+    // below 8 anchors their distance can exceed frame radius
+    unsigned k = 8;
+    while (frameError(k) > ratio) {
+        k++;
+    }
+    return k;
+}
+
+void EpsKernel2D::addOuter(double x, double y)
+{
+    if (empty_) {
+        minX_ = maxX_ = x;
+        minY_ = maxY_ = y;
+        setFrame(x, y, 0, maxAnchors_);
+        empty_ = false;
+    }
+    minX_ = std::min(minX_, x);
+    maxX_ = std::max(maxX_, x);
+    minY_ = std::min(minY_, y);
+    maxY_ = std::max(maxY_, y);
+
+    // cached hull may lag behind, its points were all fed to anchors so
+    // rejected points still lie in hull of fed ones
+    double dx = x - cx_, dy = y - cy_;
+    if (dx * dx + dy * dy > radius_ * radius_) {
+        grow(x, y);
+        cacheHull();
+    } else if (feed(x, y) && ++stale_ * 8 >= hullX_.size()) {
+        cacheHull();
+    }
+}
+
+void EpsKernel2D::setFrame(double cx, double cy, double radius, unsigned k)
+{
+    cx_ = cx;
+    cy_ = cy;
+    radius_ = radius;
+    anchors_.resize(k);
+    for (unsigned i = 0; i < k; i++) {
+        double angle = 2 * PI * i / k;
+        anchors_[i] = {cx + 2 * radius * cos(angle),
+                       cy + 2 * radius * sin(angle), 0, 0, INFINITY};
+    }
+}
+
+bool EpsKernel2D::feed(double x, double y)
+{
+    bool taken = false;
+    for (auto& anchor : anchors_) {
+        double dx = x - anchor.sx, dy = y - anchor.sy,
+               d = dx * dx + dy * dy;
+        if (d < anchor.dist) {
+            anchor.qx = x;
+            anchor.qy = y;
+            anchor.dist = d;
+            taken = true;
+        }
+    }
+    return taken;
+}
+
+void EpsKernel2D::grow(double x, double y)
+{
+    std::vector<point2d_t> kept;
+    for (auto& anchor : anchors_) {
+        kept.push_back({anchor.qx, anchor.qy});
+    }
+    kept.push_back({x, y});
+
+    double cx = (minX_ + maxX_) / 2, cy = (minY_ + maxY_) / 2,
+           far = 0;
+    for (auto& pt : kept) {
+        far = std::max(far, (pt.first - cx) * (pt.first - cx)
+                            + (pt.second - cy) * (pt.second - cy));
+    }
+    pastError_ = errorBound();
+    setFrame(cx, cy, std::max(2 * radius_, sqrt(far) * (1 + EPS)),
+             maxAnchors_);
+    for (auto& pt : kept) {
+        feed(pt.first, pt.second);
+    }
+}
+
+void EpsKernel2D::cacheHull()
+{
+    std::vector<point2d_t> pts, hull(2 * anchors_.size());
+    for (auto& anchor : anchors_) {
+        pts.push_back({anchor.qx, anchor.qy});
+    }
+    unsigned h = SmallHull2D::hull(pts.data(), pts.size(), hull.data());
+    hullX_.resize(h);
+    hullY_.resize(h);
+    stale_ = 0;
+    for (unsigned i = 0; i < h; i++) {
+        hullX_[i] = hull[i].first;
+        hullY_[i] = hull[i].second;
+    }
+}
+
+}
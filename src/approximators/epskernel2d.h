@@ -0,0 +1,139 @@
+#pragma once
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "approximators/approximator2d.h"
+#include "lib/geometry.h"
+#include "lib/structures.h"
+#include "solvers/small_hull_2d.h"
+
+namespace ch
+{
+
+/**
+ * Streaming approximation of hull by nearest points to anchors.
+ *
+ * Points are kept in a frame disk of radius R, k anchors lie evenly on
+ * the circle of radius 2R around it and each keeps the nearest point seen.
+ * In every direction, kept points reach within d^2 / (2 (R - d)) of the
+ * farthest point, where d is distance of neighbouring anchors (Dudley,
+ * Bronshteyn and Ivanov), so k = O(1 / sqrt(eps)) anchors give error
+ * eps * R. A point out of the frame doubles its radius and kept points are
+ * passed to new anchors, errors of frames sum up to at most twice the last
+ * one. Points inside of kept hull are rejected by O(log k) test, so stream
+ * is processed in O(log k) per point.
+ */
+class EpsKernel2D : public Approximator2D
+{
+    public:
+        EpsKernel2D();
+
+        /**
+         * Constructor.
+         *
+         * @param eps allowed error relative to extent of input, number
+         *            of anchors is limited to O(1 / sqrt(eps))
+         */
+        EpsKernel2D(double eps);
+
+        /**
+         * Approximates hull of input, processed as new stream
+         *
+         * Frame is fitted to whole input first, it needs about
+         * 3.2 / sqrt(eps) anchors for disk.
+         */
+        Points2D& approximate(const Points2D& input, Points2D& output);
+
+        int maxReachable() const;
+
+        /** Adds point of stream */
+        void add(double x, double y);
+
+        /** Forgets all points */
+        void clear();
+
+        /**
+         * Writes hull of kept points, in the order used by solvers
+         *
+         * @param output hull vertices are added to it
+         * @return Same as output param, reference to result
+         */
+        Points2D& getHull(Points2D& output) const;
+
+        /**
+         * Bound of distance of any seen point from hull of kept points
+         *
+         * At most eps times larger side of bounding box of input. Stream
+         * growing out of its frame can end in frame about 2.8 times larger
+         * than the box, so it uses about 10.6 / sqrt(eps) anchors.
+         */
+        double errorBound() const;
+
+        /** Number of anchors in use, each stands for one direction */
+        unsigned getDirections() const;
+
+    private:
+        /** Point on anchor circle with the nearest point seen */
+        struct Anchor {
+            double sx, sy;
+            double qx, qy;
+            /** Squared distance of the nearest point */
+            double dist;
+        };
+
+        /** Bound of frame doubling and summing of errors of frames */
+        static const double STREAM_SLACK;
+
+        /** Error of k anchors relative to frame radius */
+        static double frameError(unsigned k);
+
+        /** Fewest anchors with error at most ratio times frame radius */
+        static unsigned fitAnchors(double ratio);
+
+        /** Processes point out of kept hull */
+        void addOuter(double x, double y);
+
+        /** Places k anchors around frame, without any points */
+        void setFrame(double cx, double cy, double radius, unsigned k);
+
+        /**
+         * Offers point to all anchors
+         *
+         * @return whether some anchor took it
+         */
+        bool feed(double x, double y);
+
+        /** Doubles frame to hold point, kept points are fed again */
+        void grow(double x, double y);
+
+        /** Rebuilds cached hull of kept points, used to reject points */
+        void cacheHull();
+
+        void init(double eps);
+
+        std::vector<Anchor> anchors_;
+
+        double eps_;
+
+        unsigned maxAnchors_;
+        bool empty_;
+
+        /** Bounding box of seen points */
+        double minX_, maxX_, minY_, maxY_;
+
+        /** Frame center and radius, all fed points lie in it */
+        double cx_, cy_, radius_;
+
+        /** Sum of error bounds of previous frames */
+        double pastError_;
+
+        /** Cached vertices of hull of some kept points, in output order */
+        std::vector<double> hullX_, hullY_;
+
+        /** Points taken by anchors since hull was cached */
+        unsigned stale_;
+};
+
+}
@@ -3,6 +3,9 @@
 namespace ch
 {
 
+/** thresholds of AUTO selection, measured on 1M point inputs */
+static Calibration calibration_ = {32, 4, 500, 100000};
+
 Points2D& findHull(const Points2D& input, Points2D& output)
 {
     Quickhull2D quick;
@@ -11,6 +14,10 @@ Points2D& findHull(const Points2D& input, Points2D& output)
 
 Points2D& findHull(const Points2D& input, Points2D& output, SolverType type)
 {
+    if (type == AUTO) {
+        type = selectSolver(input, 1);
+    }
+
     Solver2D * solver = NULL;
     switch (type) {
         case JARVIS:
@@ -28,6 +35,21 @@ Points2D& findHull(const Points2D& input, Points2D& output, SolverType type)
         case ANDREW:
             solver = new MonotoneChain2D();
             break;
+        case OUELLET:
+            solver = new Ouellet2D();
+            break;
+        case KIRKPATRICK:
+            solver = new KirkpatrickSeidel2D();
+            break;
+        case DIVIDE:
+            solver = new DivideConquer2D();
+            break;
+        case RANDOMIZED:
+            solver = new RandomizedIncremental2D();
+            break;
+        case SAMPLE:
+            solver = new SampleFilter2D();
+            break;
         default:
             solver = new Quickhull2D();
             break;
@@ -53,6 +75,10 @@ Points2D& findHullParallel(const Points2D& input, Points2D& output, int thr)
 Points2D& findHullParallel(const Points2D& input, Points2D& output,
         SolverType type, int thr)
 {
+    if (type == AUTO) {
+        type = selectSolver(input, thr);
+    }
+
     Solver2D * solver = NULL;
     switch (type) {
         case JARVIS:
@@ -70,6 +96,21 @@ Points2D& findHullParallel(const Points2D& input, Points2D& output,
         case ANDREW:
             solver = new MonotoneChain2D();
             break;
+        case OUELLET:
+            solver = new Ouellet2D();
+            break;
+        case KIRKPATRICK:
+            solver = new KirkpatrickSeidel2D(KirkpatrickSeidel2D::PARA);
+            break;
+        case DIVIDE:
+            solver = new DivideConquer2D();
+            break;
+        case RANDOMIZED:
+            solver = new RandomizedIncremental2D();
+            break;
+        case SAMPLE:
+            solver = new SampleFilter2D(SampleFilter2D::PARA);
+            break;
         default:
             solver = new Quickhull2D(Quickhull2D::PARA);
             break;
@@ -86,6 +127,302 @@ Points2D& findHullParallel(const Points2D& input, Points2D& output,
     return result;
 }
 
+void findHullBatch(const std::vector<double>& coords,
+        const std::vector<size_t>& offsets,
+        std::vector<double>& hullCoords, std::vector<size_t>& hullOffsets,
+        int thr)
+{
+    hullCoords.clear();
+    hullOffsets.assign(1, 0);
+    if (offsets.size() < 2) {
+        return;
+    }
+    int sets = offsets.size() - 1;
+
+    if ((unsigned) thr > MAX_NUM_THREADS) {
+        thr = MAX_NUM_THREADS;
+    }
+    if (thr < 1) {
+        thr = 1;
+    }
+    omp_set_num_threads(thr);
+
+    // hull of set is stored in place of its points first
+    std::vector<point2d_t> hulls(offsets.back());
+    std::vector<unsigned> sizes(sets);
+#pragma omp parallel default(shared)
+    {
+        std::vector<point2d_t> pts, buffer;
+#pragma omp for schedule(dynamic, 16)
+        for (int s = 0; s < sets; s++) {
+            // sets are small, the flat buffers need 64 bit indices
+            size_t from = offsets[s];
+            unsigned n = offsets[s + 1] - from;
+            pts.resize(n);
+            buffer.resize(2 * n);
+            for (unsigned i = 0; i < n; i++) {
+                pts[i] = {coords[2 * (from + i)], coords[2 * (from + i) + 1]};
+            }
+            sizes[s] = SmallHull2D::hull(pts.data(), n, buffer.data());
+            std::copy(buffer.begin(), buffer.begin() + sizes[s],
+                      hulls.begin() + from);
+        }
+    }
+
+    hullOffsets.resize(sets + 1);
+    for (int s = 0; s < sets; s++) {
+        hullOffsets[s + 1] = hullOffsets[s] + sizes[s];
+    }
+    hullCoords.resize(2 * hullOffsets.back());
+#pragma omp parallel for default(shared) schedule(static)
+    for (int s = 0; s < sets; s++) {
+        for (size_t i = 0; i < sizes[s]; i++) {
+            hullCoords[2 * (hullOffsets[s] + i)] = hulls[offsets[s] + i].first;
+            hullCoords[2 * (hullOffsets[s] + i) + 1] =
+                hulls[offsets[s] + i].second;
+        }
+    }
+}
+
+/** Splits hull vertices to arrays of coordinates */
+static void splitCoords(const data_t& hull, std::vector<double>& xs,
+                        std::vector<double>& ys)
+{
+    xs.resize(hull.size());
+    ys.resize(hull.size());
+    for (unsigned i = 0; i < hull.size(); i++) {
+        xs[i] = hull[i][0];
+        ys[i] = hull[i][1];
+    }
+}
+
+/** Implementation of updateHull, thr > 1 runs it in parallel */
+static Points2D& extendHull(const Points2D& hull, const Points2D& batch,
+        Points2D& output, int thr)
+{
+    const data_t& hullData = hull.getData(), & batchData = batch.getData();
+    int n = batchData.size();
+
+    // only points out of hull can change it
+    std::vector<char> keep(n, 1);
+    if (hullData.size() >= 3) {
+        std::vector<double> hx, hy;
+        splitCoords(hullData, hx, hy);
+        int k = hx.size();
+#pragma omp parallel for default(shared) schedule(static) if(thr > 1)
+        for (int i = 0; i < n; i++) {
+            keep[i] = !ptInHull(hx.data(), hy.data(), k,
+                                batchData[i][0], batchData[i][1]);
+        }
+    }
+    Points2D rest, restHull;
+    for (int i = 0; i < n; i++) {
+        if (keep[i]) {
+            rest.add(batchData[i]);
+        }
+    }
+    R("Update kept " << rest.getSize() << " of " << n)
+    if (thr > 1) {
+        findHullParallel(rest, restHull, thr);
+    } else {
+        findHull(rest, restHull);
+    }
+
+    // both hulls split to sorted chains, merged in linear time
+    HullSummary::merge(HullSummary(hull), HullSummary(restHull))
+        .getHull(output);
+    return output;
+}
+
+Points2D& updateHull(const Points2D& hull, const Points2D& batch,
+        Points2D& output)
+{
+    return extendHull(hull, batch, output, 1);
+}
+
+Points2D& updateHullParallel(const Points2D& hull, const Points2D& batch,
+        Points2D& output, int thr)
+{
+    if ((unsigned) thr > MAX_NUM_THREADS) {
+        thr = MAX_NUM_THREADS;
+    }
+    if (thr < 1) {
+        thr = 1;
+    }
+    omp_set_num_threads(thr);
+    return extendHull(hull, batch, output, thr);
+}
+
+/**
+ * Reads next chunk of stream
+ *
+ * @param remaining points left in TEXT stream, decreased by read ones
+ * @return false if stream ends in the middle of chunk unexpectedly
+ */
+static bool readChunk(std::istream& is, StreamFormat format,
+        long long& remaining, unsigned chunkSize, Points2D& chunk)
+{
+    if (format == BINARY) {
+        std::vector<double> buffer(2 * chunkSize);
+        is.read((char*) buffer.data(), buffer.size() * sizeof(double));
+        std::streamsize bytes = is.gcount();
+        if (bytes % (2 * sizeof(double))) {
+            return false;
+        }
+        for (unsigned i = 0; i < bytes / sizeof(double); i += 2) {
+            chunk.add({buffer[i], buffer[i + 1]});
+        }
+        return true;
+    }
+
+    double a, b;
+    while (chunk.getSize() < chunkSize && remaining > 0) {
+        if (!(is >> a >> b)) {
+            return false;
+        }
+        chunk.add({a, b});
+        remaining--;
+    }
+    return true;
+}
+
+bool findHullStream(std::istream& is, StreamFormat format, Points2D& output,
+        SolverType type, unsigned chunkSize, int thr)
+{
+    long long remaining = 0;
+    if (format == TEXT && !(is >> remaining)) {
+        return false;
+    }
+    if (chunkSize < 1) {
+        chunkSize = 1;
+    }
+
+    HullSummary summary;
+    Points2D hull;
+    while (true) {
+        Points2D chunk;
+        if (!readChunk(is, format, remaining, chunkSize, chunk)) {
+            return false;
+        }
+        if (chunk.getSize() == 0) {
+            break;
+        }
+        const data_t& chunkData = chunk.getData();
+        std::vector<double> hx, hy;
+        splitCoords(hull.getData(), hx, hy);
+        int k = hx.size();
+
+        // whole chunk is rejected, if its bounding box is inside of hull
+        if (k >= 3) {
+            double minX = chunkData[0][0], maxX = minX,
+                   minY = chunkData[0][1], maxY = minY;
+            for (auto& pt : chunkData) {
+                minX = std::min(minX, pt[0]);
+                maxX = std::max(maxX, pt[0]);
+                minY = std::min(minY, pt[1]);
+                maxY = std::max(maxY, pt[1]);
+            }
+            if (ptInHull(hx.data(), hy.data(), k, minX, minY)
+                && ptInHull(hx.data(), hy.data(), k, minX, maxY)
+                && ptInHull(hx.data(), hy.data(), k, maxX, minY)
+                && ptInHull(hx.data(), hy.data(), k, maxX, maxY)) {
+                R("Stream skipped chunk")
+                continue;
+            }
+        }
+
+        Points2D rest, restHull;
+        for (auto& pt : chunkData) {
+            if (k < 3 || !ptInHull(hx.data(), hy.data(), k, pt[0], pt[1])) {
+                rest.add(pt);
+            }
+        }
+        if (thr > 1) {
+            findHullParallel(rest, restHull, type, thr);
+        } else {
+            findHull(rest, restHull, type);
+        }
+        summary = HullSummary::merge(summary, HullSummary(restHull));
+        hull.clear();
+        summary.getHull(hull);
+    }
+
+    for (auto& pt : hull.getData()) {
+        output.add(pt);
+    }
+    return true;
+}
+
+bool loadCalibration(const std::string& filename)
+{
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    Calibration loaded = calibration_;
+    std::string line, key;
+    while (std::getline(file, line)) {
+        std::istringstream iss(line);
+        if (!(iss >> key) || key[0] == '#') {
+            continue;
+        }
+        unsigned value;
+        if (!(iss >> value)) {
+            return false;
+        }
+        if (key == "small_n") {
+            loaded.smallN = value;
+        } else if (key == "jarvis_max_h") {
+            loaded.jarvisMaxH = value;
+        } else if (key == "quickhull_max_h") {
+            loaded.quickhullMaxH = value;
+        } else if (key == "parallel_min_n") {
+            loaded.parallelMinN = value;
+        } else {
+            return false;
+        }
+    }
+
+    calibration_ = loaded;
+    return true;
+}
+
+const Calibration& getCalibration()
+{
+    return calibration_;
+}
+
+void setCalibration(const Calibration& calibration)
+{
+    calibration_ = calibration;
+}
+
+SolverType selectSolver(const Points2D& input, int threads)
+{
+    unsigned n = input.getSize();
+    if (n <= calibration_.smallN) {
+        return ANDREW;
+    }
+
+    BFP2D bfp;
+    Points2D approx;
+    bfp.approximate(input, approx);
+    unsigned h = approx.getSize();
+    if (h >= 0.9 * bfp.maxReachable()) {
+        // approximation saturated, hull may be much larger
+        h = std::max(h, calibration_.quickhullMaxH + 1);
+    }
+
+    if (threads > 1 && n >= calibration_.parallelMinN) {
+        return h <= calibration_.quickhullMaxH ? QUICKHULL : DIVIDE;
+    }
+    if (h <= calibration_.jarvisMaxH) {
+        return JARVIS;
+    }
+    return h <= calibration_.quickhullMaxH ? QUICKHULL : OUELLET;
+}
+
 Points2D& approximateHull(const Points2D& input, Points2D& output)
 {
     BFP2D bfp;
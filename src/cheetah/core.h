@@ -1,6 +1,9 @@
 #pragma once
 
 #include <omp.h>
+#include <string>
+#include <fstream>
+#include <sstream>
 
 #include "approximators/bfp2d.h"
 
@@ -10,7 +13,14 @@
 #include "solvers/graham_scan_2d.h"
 #include "solvers/jarvis_scan_2d.h"
 #include "solvers/jarvis_scan_3d.h"
+#include "solvers/kirkpatrick_seidel_2d.h"
+#include "solvers/divide_conquer_2d.h"
+#include "solvers/randomized_incremental_2d.h"
+#include "solvers/sample_filter_2d.h"
+#include "solvers/small_hull_2d.h"
+#include "solvers/hull_summary_2d.h"
 #include "solvers/monotone_chain_2d.h"
+#include "solvers/ouellet_2d.h"
 #include "solvers/quickhull_2d.h"
 
 /**
@@ -31,7 +41,8 @@ namespace ch
 Points2D& findHull(const Points2D& input, Points2D& output);
 
 /** Enumerates types of 2d solvers */
-enum SolverType {JARVIS, GRAHAM, ANDREW, QUICKHULL, CHAN};
+enum SolverType {JARVIS, GRAHAM, ANDREW, QUICKHULL, CHAN, OUELLET,
+    KIRKPATRICK, DIVIDE, RANDOMIZED, SAMPLE, AUTO};
 
 /**
  * Uses chosen algorithm to find convex hull of given point set
@@ -53,7 +64,115 @@ Points2D& findHullParallel(const Points2D& input, Points2D& output, int thr);
  */
 Points2D& findHullParallel(const Points2D& input, Points2D& output, 
         SolverType type, int thr);
+/**
+ * Finds convex hulls of many small point sets at once
+ *
+ * Sets are solved in parallel by small input kernel, without allocation
+ * of points or solvers per set.
+ *
+ * @param coords coordinates of all points, x and y of each point in turn
+ * @param offsets first point of each set, followed by total number of
+ *                points (set i has points offsets[i] to offsets[i+1] - 1)
+ * @param hullCoords coordinates of points of all hulls, same layout
+ * @param hullOffsets first point of each hull, same layout as offsets
+ * @param thr number of threads
+ */
+void findHullBatch(const std::vector<double>& coords,
+        const std::vector<size_t>& offsets,
+        std::vector<double>& hullCoords, std::vector<size_t>& hullOffsets,
+        int thr);
 
+/**
+ * Extends known hull by batch of new points
+ *
+ * New points strictly inside of hull are dropped by O(log h) tests, the
+ * rest is solved by Quickhull and merged with hull in linear time.
+ *
+ * @param hull hull of previous points, in the order produced by solvers
+ * @param batch new points
+ * @param output hull of previous and new points
+ *
+ * @return Same as output param, reference to result
+ */
+Points2D& updateHull(const Points2D& hull, const Points2D& batch,
+        Points2D& output);
+
+/** Parallel version of updateHull, allows to choose number of threads */
+Points2D& updateHullParallel(const Points2D& hull, const Points2D& batch,
+        Points2D& output, int thr);
+
+/** Formats of point streams read by findHullStream */
+enum StreamFormat {TEXT, BINARY};
+
+/**
+ * Finds hull of points read from stream by chunks, without keeping them
+ *
+ * Chunk whose bounding box lies inside of current hull is skipped whole,
+ * otherwise its points inside of hull are dropped by O(log h) tests. Rest
+ * is solved by chosen solver and merged into current hull, so memory is
+ * bounded by chunk size and hull size.
+ *
+ * @param is input stream, TEXT is format of command line application
+ *           (number of points followed by their coordinates), BINARY is
+ *           sequence of x and y coordinates as native doubles
+ * @param format format of stream
+ * @param output Reference to set of points containing convex hull
+ * @param type SolverType of chosen algorithm
+ * @param chunkSize maximal number of points read at once
+ * @param thr number of threads, chunks are solved in parallel if above 1
+ *
+ * @return false if stream ends in the middle of point or before announced
+ *         number of points, output is unchanged then
+ */
+bool findHullStream(std::istream& is, StreamFormat format, Points2D& output,
+        SolverType type, unsigned chunkSize, int thr);
+
+/**
+ * Thresholds of AUTO solver selection
+ *
+ * Best solver depends mostly on input size and estimated hull size, values
+ * can be measured by PerfTest::testEdges and loaded by loadCalibration.
+ */
+struct Calibration {
+    /** Inputs up to this size are solved by monotone chain */
+    unsigned smallN;
+    /** Estimated hull sizes up to this use Jarvis scan */
+    unsigned jarvisMaxH;
+    /** Estimated hull sizes up to this use Quickhull, larger ones Ouellet */
+    unsigned quickhullMaxH;
+    /** Minimal input size to use parallel solver, when threads are given */
+    unsigned parallelMinN;
+};
+
+/**
+ * Loads thresholds of AUTO selection from file
+ *
+ * File contains lines "key value" with keys small_n, jarvis_max_h,
+ * quickhull_max_h and parallel_min_n, missing keys keep their values.
+ * Lines starting with # are ignored.
+ *
+ * @param filename calibration file
+ * @return false if file cannot be read or contains unknown key, thresholds
+ *         stay unchanged in that case
+ */
+bool loadCalibration(const std::string& filename);
+
+/** Returns thresholds currently used by AUTO selection */
+const Calibration& getCalibration();
+
+/** Replaces thresholds used by AUTO selection */
+void setCalibration(const Calibration& calibration);
+
+/**
+ * Chooses solver for AUTO mode
+ *
+ * Hull size is estimated by BFP approximation, in linear time.
+ *
+ * @param input Input set of points
+ * @param threads number of threads available to solver
+ * @return chosen SolverType, never AUTO
+ */
+SolverType selectSolver(const Points2D& input, int threads);
 
 /**
  * Approximates convex hull of given set of points using BFP approximation
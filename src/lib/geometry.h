@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <utility>
+#include <algorithm>
 
 #include "lib/structures.h"
 
@@ -203,6 +204,57 @@ bool ptInTriangle(double ax, double ay,
                   double cx, double cy,
                   double px, double py);
 
+/**
+ * One step of binary search over fan of triangles from first vertex of
+ * convex polygon with k >= 3 vertices in output order, without branches
+ *
+ * @return lo + step, bounded by k - 2, if point lies strictly right of ray
+ *         to that vertex, lo otherwise
+ */
+inline int fanStep(const double* hx, const double* hy, int k,
+                   int lo, int step, double x, double y)
+{
+    // rays of fan turn right with index, point is passed in the middle,
+    // so orientation is exactly zero for point on vertex
+    int mid = std::min(lo + step, k - 2);
+    return cross(hx[mid], hy[mid], x, y, hx[0], hy[0]) < 0 ? mid : lo;
+}
+
+/**
+ * Finds triangle of fan from first vertex of convex polygon with k >= 3
+ * vertices in output order, which contains point if polygon does
+ *
+ * @return lo, point lies between rays to vertices lo and lo + 1
+ */
+inline int fanTriangle(const double* hx, const double* hy, int k,
+                       double x, double y)
+{
+    int lo = 1, step = 1;
+    while (2 * step < k - 2) {
+        step *= 2;
+    }
+    for (; step > 0; step /= 2) {
+        lo = fanStep(hx, hy, k, lo, step, x, y);
+    }
+    return lo;
+}
+
+/**
+ * finds out if point lies strictly inside of convex polygon with k >= 3
+ * vertices in output order, in O(log k)
+ */
+inline bool ptInHull(const double* hx, const double* hy, int k,
+                     double x, double y)
+{
+    // polygon turns right, inner points are right of every edge
+    if (cross(hx[1], hy[1], x, y, hx[0], hy[0]) > -EPS
+        || cross(hx[k - 1], hy[k - 1], x, y, hx[0], hy[0]) < EPS) {
+        return false;
+    }
+    int lo = fanTriangle(hx, hy, k, x, y);
+    return cross(hx[lo + 1], hy[lo + 1], x, y, hx[lo], hy[lo]) < -EPS;
+}
+
 /** finds out if point is in given ccw ordered polygon */
 inline bool ptInPolygon(const data_t& poly, const point_t& point)
 {
@@ -1,4 +1,7 @@
+#include <algorithm>
+
 #include "lib/structures.h"
+#include "lib/geometry.h"
 
 namespace ch
 {
@@ -18,6 +21,24 @@ Points2D::Points2D()
     : PointsND(2)
 {}
 
+void Points2D::orderHull()
+{
+    unsigned h = data_.size(), lo = 0;
+    for (unsigned i = 1; i < h; i++) {
+        if (data_[i] < data_[lo]) {
+            lo = i;
+        }
+    }
+    std::rotate(data_.begin(), data_.begin() + lo, data_.end());
+
+    // smallest vertex is extreme, turn at it gives orientation
+    if (h >= 3 && cross(data_[h - 1][0], data_[h - 1][1],
+                        data_[0][0], data_[0][1],
+                        data_[1][0], data_[1][1]) > 0) {
+        std::reverse(data_.begin() + 1, data_.end());
+    }
+}
+
 Points3D::Points3D()
     : PointsND(3)
 {}
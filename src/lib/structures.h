@@ -59,6 +59,12 @@ class Points2D : public PointsND
 {
     public:
         Points2D();
+
+        /**
+         * Brings hull to the order of solver output, clockwise starting at
+         * the lexicographically smallest vertex
+         */
+        void orderHull();
 };
 
 class Points3D : public PointsND
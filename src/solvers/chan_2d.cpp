@@ -7,16 +7,23 @@ Chan2D::Chan2D()
 {
     name_ = "Chan";
     variant_ = PARA_OVER;
+    parallelThreshold_ = 64;
 }
 
 Chan2D::Chan2D(Variant v)
 {
     name_ = "Chan";
     variant_ = v;
+    parallelThreshold_ = 64;
 }
 
 Points2D& Chan2D::solve(const Points2D& input, Points2D& output)
 {
+    SolveScope scope(*this, output);
+    if (input.getSize() <= SmallHull2D::TINY_SIZE) {
+        return scope.delegated(SmallHull2D::solveTiny(input, output));
+    }
+
     switch (variant_) {
         case JARVIS:
             solver_ = new JarvisScan2D();
@@ -48,7 +55,9 @@ Points2D& Chan2D::solveNaive(const Points2D& input, Points2D& output)
     // find hull size, stop one step after input size
     for (unsigned h = 1; ppow(h-1) < input.getSize(); h++) {
         std::vector<Points2D> hulls;
-        findHulls(input, hulls, ppow(h));
+        unsigned long long m = std::min(ppow(h),
+                (unsigned long long) input.getSize());
+        findHulls(input, hulls, m);
 
         unsigned pivot = 0,
                  minHull = findMinHull(hulls, pivot);
@@ -68,7 +77,7 @@ Points2D& Chan2D::solveNaive(const Points2D& input, Points2D& output)
         }
         if (fnd) {
             for (auto& i : overallHull) {
-                output.add(hulls[i.second].getData()[i.first]);
+                emit(output, hulls[i.second].getData()[i.first]);
             }
             return output;
         }
@@ -107,6 +116,7 @@ void Chan2D::findHulls(const Points2D& input, std::vector<Points2D>& hulls,
                     Quickhull2D local;
                     local.solve(part, hulls[i]);
                 }
+                compactHull(hulls[i]);
             }
             break;
 
@@ -120,6 +130,7 @@ void Chan2D::findHulls(const Points2D& input, std::vector<Points2D>& hulls,
                 }
                 GrahamScan2D local(GrahamScan2D::PARA);
                 local.solve(part, hulls[i]);
+                compactHull(hulls[i]);
             }
             break;
 
@@ -131,6 +142,7 @@ void Chan2D::findHulls(const Points2D& input, std::vector<Points2D>& hulls,
                     part.add(inputData[j]);
                 }
                 solver_ -> solve(part, hulls[i]);
+                compactHull(hulls[i]);
             }
     }
 }
@@ -141,30 +153,45 @@ std::pair<unsigned, unsigned> Chan2D::findNext(std::vector<Points2D>& hulls,
     std::pair<unsigned, unsigned> cand;
     cand.first = (curr.first + 1) % (hulls[curr.second].getSize());
     cand.second = curr.second;
-    point_t currP = hulls[curr.second].getData()[curr.first],
-            candP = hulls[cand.second].getData()[cand.first],
-            propP;
+    point_t currP = hulls[curr.second].getData()[curr.first];
 
-    for (unsigned sub = 0; sub < hulls.size(); sub++) {
-        if (sub == curr.second) {
-            continue;
+    bool para = variant_ == PARA_ALGO || variant_ == PARA_OVER
+             || variant_ == PARA_COMBO;
+    if (!para || hulls.size() < parallelThreshold_) {
+        for (unsigned sub = 0; sub < hulls.size(); sub++) {
+            if (sub == curr.second) {
+                continue;
+            }
+            std::pair<unsigned, unsigned> prop = {findTangent(hulls[sub],
+                    currP), sub};
+            if (isBetter(hulls, currP, cand, prop)) {
+                cand = prop;
+            }
         }
+        return cand;
+    }
 
-        unsigned tgt = findTangent(hulls[sub], currP);
-        propP = hulls[sub].getData()[tgt];
-        int o = orientation(currP[0], currP[1],
-                            candP[0], candP[1],
-                            propP[0], propP[1]);
-
-        if (o == 1) {
-            // right turn
-            cand = {tgt, sub};
-            candP = propP;
-        } else if (o == 0) {
-            // collinear
-            if (dist(currP, candP) < dist(currP, propP)) {
-                cand = {tgt, sub};
-                candP = propP;
+    // tangent queries in parallel, each thread keeps its best candidate in
+    // private variable, so threads do not share cache lines while wrapping
+    const std::pair<unsigned, unsigned> seed = cand;
+#pragma omp parallel default(shared)
+    {
+        std::pair<unsigned, unsigned> best = seed;
+#pragma omp for schedule(static)
+        for (int sub = 0; sub < (int) hulls.size(); sub++) {
+            if ((unsigned) sub == curr.second) {
+                continue;
+            }
+            std::pair<unsigned, unsigned> prop = {findTangent(hulls[sub],
+                                                              currP), sub};
+            if (isBetter(hulls, currP, best, prop)) {
+                best = prop;
+            }
+        }
+#pragma omp critical
+        {
+            if (isBetter(hulls, currP, cand, best)) {
+                cand = best;
             }
         }
     }
@@ -172,10 +199,31 @@ std::pair<unsigned, unsigned> Chan2D::findNext(std::vector<Points2D>& hulls,
     return cand;
 }
 
+bool Chan2D::isBetter(const std::vector<Points2D>& hulls, const point_t& currP,
+                      std::pair<unsigned, unsigned> cand,
+                      std::pair<unsigned, unsigned> prop)
+{
+    const point_t& candP = hulls[cand.second].getData()[cand.first],
+                 & propP = hulls[prop.second].getData()[prop.first];
+    int o = orientation(currP[0], currP[1],
+                        candP[0], candP[1],
+                        propP[0], propP[1]);
+
+    if (o == 1) {
+        // right turn
+        return 1;
+    } else if (o == 0) {
+        // collinear
+        return dist(currP[0], currP[1], candP[0], candP[1])
+             < dist(currP[0], currP[1], propP[0], propP[1]);
+    }
+    return 0;
+}
+
 unsigned Chan2D::findMinHull(std::vector<Points2D>& hulls, unsigned& minPt)
 {
     unsigned lies = 0;
-    double minX = DBL_MIN;
+    double minX = DBL_MAX;
     for (unsigned h = 0; h < hulls.size(); h++) {
         const data_t& hull = hulls[h].getData();
         for (unsigned i = 0; i < hull.size(); i++) {
@@ -198,71 +246,156 @@ unsigned Chan2D::findMinHull(std::vector<Points2D>& hulls, unsigned& minPt)
 
 unsigned Chan2D::findTangent(const Points2D& hull, point_t& p)
 {
-    R("pt: " << p[0] << " " << p[1])
     const data_t& hdata = hull.getData();
-    if (hdata.size() == 1) {
+    unsigned s = hdata.size();
+    if (s == 1) {
         return 0;
     }
 
-    if (hdata.size() == 2) {
-        if (dist(p, hdata[0]) > dist(p, hdata[1])) {
+    if (s == 2) {
+        int o = orientation(p[0],        p[1],
+                            hdata[0][0], hdata[0][1],
+                            hdata[1][0], hdata[1][1]);
+        if (o == 2 || (o == 0 && dist(p, hdata[0]) > dist(p, hdata[1]))) {
             return 0;
         } else {
             return 1;
         }
     }
 
-    R("  hull");
-    for (auto i : hdata) {
-        R("  " << p[0] << " " << p[1]);
-    }
+    // edge i goes "up" if its end lies to the left of ray p -> hdata[i],
+    // tangent point is the vertex where edges stop going up
+    auto edge = [&](unsigned i) {
+        unsigned j = (i + 1) % s;
+        return orientation(p[0],        p[1],
+                           hdata[i][0], hdata[i][1],
+                           hdata[j][0], hdata[j][1]);
+    };
+    auto isTangent = [&](unsigned i) {
+        return edge(i) != 1 && edge((i + s - 1) % s) != 2
+            && dist(p, hdata[i]) > EPS;
+    };
+    // hdata[i] lies to the left of ray p -> hdata[j]
+    auto above = [&](unsigned i, unsigned j) {
+        return orientation(p[0],        p[1],
+                           hdata[j][0], hdata[j][1],
+                           hdata[i][0], hdata[i][1]) == 1;
+    };
 
-    unsigned left = 0, right = hdata.size() - 1, mid, s = hdata.size();
-    int olFrnt = orientation(p[0],            p[1],
-                             hdata[0][0],     hdata[0][1],
-                             hdata[1][0],     hdata[1][1]),
-        olBack = orientation(p[0],            p[1],
-                             hdata[0][0],     hdata[0][1],
-                             hdata[s - 1][0], hdata[s - 1][1]);
+    unsigned tgt = s;
+    if (isTangent(0)) {
+        tgt = 0;
+    }
 
-    while (left < right) {
+    // binary search over chain [left, right], hdata[s] = hdata[0]
+    unsigned left = 0, right = s, mid;
+    while (tgt == s && right - left > 1) {
         mid = (left + right) / 2;
-        // R(left << " - " << mid << " - " << right);
-        int dm = (mid == 0) ? s - 1 : mid - 1;
-
-        int omFrnt = orientation(p[0],                  p[1],
-                                 hdata[mid][0],         hdata[mid][1],
-                                 hdata[(mid+1) % s][0], hdata[(mid+1) % s][1]);
-        int omBack = orientation(p[0],          p[1],
-                                 hdata[mid][0], hdata[mid][1],
-                                 hdata[dm][0],  hdata[dm][1]);
-        int omSelf = orientation(p[0],           p[1],
-                                 hdata[left][0], hdata[left][1],
-                                 hdata[mid][0],  hdata[mid][1]);
-
-        if (omBack != 1 && omFrnt != 1) {
-            R("  tangent pt: " << hdata[mid][0] << " " << hdata[mid][1])
-            return mid;
+        if (isTangent(mid)) {
+            tgt = mid;
+            break;
         }
 
-        if (   (omSelf == 1 && omBack == 1)
-            || (omSelf == 2 && (olFrnt == 1 || olBack == olFrnt))) {
-            right = mid;
+        bool upLeft = edge(left) != 2,
+             upMid  = edge(mid)  != 2;
+        if (upLeft) {
+            if (!upMid || above(left, mid)) {
+                right = mid;
+            } else {
+                left = mid;
+            }
         } else {
-            left = mid + 1;
-            olBack = omFrnt;
-            if (omFrnt == 1) {
-                olBack = 2;
-            } else if (omFrnt == 2) {
-                olBack = 1;
+            if (upMid || !above(mid, left)) {
+                left = mid;
+            } else {
+                right = mid;
+            }
+        }
+    }
+
+    // numerical problems or p touching the subhull, use linear scan
+    if (tgt == s) {
+        R("fallback")
+        for (unsigned i = 0; i < s; i++) {
+            if (isTangent(i)) {
+                tgt = i;
+                break;
+            }
+        }
+        if (tgt == s) {
+            tgt = 0;
+            for (unsigned i = 1; i < s; i++) {
+                if (above(i, tgt)) {
+                    tgt = i;
+                }
             }
-            olFrnt = orientation(p[0], p[1],
-                hdata[left][0], hdata[left][1],
-                hdata[(left+1) % s][0], hdata[(left+1) % s][1]);
         }
     }
-    R("fallback")
-    return left;
+
+    // prefer farthest of collinear tangent points
+    unsigned next = (tgt + 1) % s, prev = (tgt + s - 1) % s;
+    if (edge(tgt) == 0 && dist(p, hdata[next]) > dist(p, hdata[tgt])) {
+        tgt = next;
+    } else if (edge(prev) == 0
+               && dist(p, hdata[prev]) > dist(p, hdata[tgt])) {
+        tgt = prev;
+    }
+
+    return tgt;
+}
+
+void Chan2D::compactHull(Points2D& hull)
+{
+    data_t hdata = hull.getData();
+    if (hdata.size() <= 2) {
+        return;
+    }
+
+    std::vector<unsigned> stack;
+    for (unsigned i = 0; i < hdata.size(); i++) {
+        while (stack.size() >= 2 && !ccw(hdata[stack[stack.size() - 2]],
+                                         hdata[stack.back()],
+                                         hdata[i])) {
+            stack.pop_back();
+        }
+        stack.push_back(i);
+    }
+
+    // close the polygon
+    unsigned first = 0;
+    while (stack.size() - first >= 3 && !ccw(hdata[stack[stack.size() - 2]],
+                                             hdata[stack.back()],
+                                             hdata[stack[first]])) {
+        stack.pop_back();
+    }
+    while (stack.size() - first >= 3 && !ccw(hdata[stack.back()],
+                                             hdata[stack[first]],
+                                             hdata[stack[first + 1]])) {
+        first++;
+    }
+
+    hull.clear();
+    if (stack.size() - first >= 3) {
+        for (unsigned i = first; i < stack.size(); i++) {
+            hull.add(hdata[stack[i]]);
+        }
+        return;
+    }
+
+    // all points collinear, keep endpoints only
+    unsigned minPt = 0, maxPt = 0;
+    for (unsigned i = 1; i < hdata.size(); i++) {
+        if (hdata[i] < hdata[minPt]) {
+            minPt = i;
+        }
+        if (hdata[maxPt] < hdata[i]) {
+            maxPt = i;
+        }
+    }
+    hull.add(hdata[minPt]);
+    if (dist(hdata[minPt], hdata[maxPt]) > EPS) {
+        hull.add(hdata[maxPt]);
+    }
 }
 
 }
@@ -10,6 +10,7 @@
 #include "solvers/monotone_chain_2d.h"
 #include "solvers/quickhull_2d.h"
 #include "solvers/solver_2d.h"
+#include "solvers/small_hull_2d.h"
 
 namespace ch
 {
@@ -25,11 +26,24 @@ class Chan2D : public Solver2D
         Chan2D(Variant v);
 
     private:
-        inline unsigned ppow(unsigned x) { return 1U << (1U << x); }
+        inline unsigned long long ppow(unsigned x)
+        {
+            return (x >= 6) ? ~0ULL : 1ULL << (1ULL << x);
+        }
         Points2D& solveNaive(const Points2D& input, Points2D& output);
         void findHulls(const Points2D& input, std::vector<Points2D>& hulls,
                        unsigned step);
 
+        /**
+         * Removes collinear and duplicate points from ordered subhull
+         *
+         * Tangent search requires strictly convex polygon, fully degenerate
+         * subhulls are reduced to their two endpoints.
+         *
+         * @param hull ordered subhull, modified in place
+         */
+        void compactHull(Points2D& hull);
+
         /**
          * Finds point with minimal x coordinate, along with hull it lies on
          *
@@ -42,6 +56,9 @@ class Chan2D : public Solver2D
         /**
          * Finds next point on overall hull
          *
+         * Parallel variants query tangents of subhulls concurrently once
+         * there are at least parallelThreshold_ of them.
+         *
          * @param hulls list of subhulls
          * @param pt pair of point index and hull index of current point
          * @return pair of point index and hull index
@@ -49,12 +66,28 @@ class Chan2D : public Solver2D
         std::pair<unsigned, unsigned> findNext(std::vector<Points2D>& hulls,
                 std::pair<unsigned, unsigned> curr);
 
+        /**
+         * Decides whether proposed point wraps the hull tighter than current
+         * candidate, as seen from current hull point
+         *
+         * @param hulls list of subhulls
+         * @param currP current point on overall hull
+         * @param cand pair of point index and hull index of candidate
+         * @param prop pair of point index and hull index of proposed point
+         * @return true if proposed point should replace candidate
+         */
+        bool isBetter(const std::vector<Points2D>& hulls, const point_t& currP,
+                      std::pair<unsigned, unsigned> cand,
+                      std::pair<unsigned, unsigned> prop);
+
         /**
          * Finds point on hull touched by left tangent line from point p
          *
-         * Complexity O(n log n) using binary search
+         * Complexity O(log n) using binary search over the edges of hull,
+         * degenerate configurations fall back to linear scan. From several
+         * collinear candidates the farthest one is chosen.
          *
-         * @param hull ordered convex subhull we are searching on
+         * @param hull ordered strictly convex subhull we are searching on
          * @param p specified point of tangent line
          * @return id of found point on its subhull
          */
@@ -62,6 +95,9 @@ class Chan2D : public Solver2D
 
         Variant variant_;
 
+        /** Minimal number of subhulls to run wrapping step in parallel */
+        unsigned parallelThreshold_;
+
         /** Chosen solver for sub-hulls */
         Solver2D* solver_;
         /** Flag marking change of solvers in combo variant */
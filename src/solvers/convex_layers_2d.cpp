@@ -0,0 +1,269 @@
+#include "solvers/convex_layers_2d.h"
+#include "solvers/small_hull_2d.h"
+
+namespace ch
+{
+
+ConvexLayers2D::ConvexLayers2D()
+{
+    variant_ = SEQ;
+    annulusSize_ = 1024;
+    minPool_ = 8192;
+    sampleSize_ = 32768;
+    rng_.seed(1);
+}
+
+ConvexLayers2D::ConvexLayers2D(Variant v)
+{
+    variant_ = v;
+    annulusSize_ = 1024;
+    minPool_ = 8192;
+    sampleSize_ = 32768;
+    rng_.seed(1);
+}
+
+std::vector<Points2D>& ConvexLayers2D::solve(const Points2D& input,
+                                             std::vector<Points2D>& layers)
+{
+    const data_t& inputData = input.getData();
+    unsigned n = inputData.size();
+    xar_.resize(n);
+    yar_.resize(n);
+    std::vector<unsigned> order(n), rep(n);
+    for (unsigned i = 0; i < n; i++) {
+        xar_[i] = inputData[i][0];
+        yar_[i] = inputData[i][1];
+        order[i] = i;
+    }
+
+    // coincident points would make zero length chain edges, only the
+    // first of them is peeled and the others share its depth
+    std::sort(order.begin(), order.end(), [this](unsigned a, unsigned b) {
+        return xar_[a] < xar_[b] || (xar_[a] == xar_[b]
+                                     && (yar_[a] < yar_[b]
+                                         || (yar_[a] == yar_[b] && a < b)));
+    });
+    pool_.clear();
+    for (unsigned i = 0; i < n; i++) {
+        unsigned id = order[i], prev = i ? order[i - 1] : id;
+        if (i > 0 && xar_[id] == xar_[prev] && yar_[id] == yar_[prev]) {
+            rep[id] = rep[prev];
+        } else {
+            rep[id] = id;
+            pool_.push_back(id);
+        }
+    }
+    unsigned distinct = pool_.size();
+    depth_.assign(n, 0);
+    coreOf_.assign(n, 0);
+    seen_.assign(n, 0);
+    stamp_ = 0;
+    ring_.clear();
+    marked_.clear();
+    rebuildCores();
+
+    unsigned peeled = 0;
+    std::vector<unsigned> layer;
+    while (peeled < distinct) {
+        peel(layer);
+
+        // core stays valid while all its vertices remain
+        bool broken = false;
+        Points2D output;
+        for (auto id : layer) {
+            depth_[id] = layers.size();
+            output.add(inputData[id]);
+            broken |= coreOf_[id] == active_ + 1;
+        }
+        layers.push_back(output);
+        peeled += layer.size();
+        if (broken) {
+            nextCore();
+        }
+    }
+    for (unsigned i = 0; i < n; i++) {
+        depth_[i] = depth_[rep[i]];
+    }
+    return layers;
+}
+
+const std::vector<unsigned>& ConvexLayers2D::getDepths() const
+{
+    return depth_;
+}
+
+void ConvexLayers2D::boundary(const std::vector<Item>& sorted,
+                              std::vector<unsigned>& layer)
+{
+    // monotone chains keeping points on edges, collinear turns stay
+    std::vector<unsigned> upper, lower;
+    for (unsigned i = 0; i < sorted.size(); i++) {
+        const Item& p = sorted[i];
+        while (upper.size() >= 2) {
+            const Item& a = sorted[upper[upper.size() - 2]],
+                      & b = sorted[upper.back()];
+            if (cross(a.x, a.y, b.x, b.y, p.x, p.y) <= EPS) {
+                break;
+            }
+            upper.pop_back();
+        }
+        upper.push_back(i);
+        while (lower.size() >= 2) {
+            const Item& a = sorted[lower[lower.size() - 2]],
+                      & b = sorted[lower.back()];
+            if (cross(a.x, a.y, b.x, b.y, p.x, p.y) >= -EPS) {
+                break;
+            }
+            lower.pop_back();
+        }
+        lower.push_back(i);
+    }
+
+    // upper chain left to right, then lower back, each point once
+    layer.clear();
+    stamp_++;
+    for (auto i : upper) {
+        seen_[sorted[i].id] = stamp_;
+        layer.push_back(sorted[i].id);
+    }
+    for (int i = (int) lower.size() - 1; i >= 0; i--) {
+        unsigned id = sorted[lower[i]].id;
+        if (seen_[id] != stamp_) {
+            seen_[id] = stamp_;
+            layer.push_back(id);
+        }
+    }
+}
+
+void ConvexLayers2D::dropMarked(std::vector<Item>& sorted)
+{
+    unsigned stamp = stamp_;
+    sorted.erase(std::remove_if(sorted.begin(), sorted.end(),
+                     [this, stamp](const Item& p) {
+                         return seen_[p.id] == stamp;
+                     }),
+                 sorted.end());
+}
+
+void ConvexLayers2D::rebuildCores()
+{
+    for (auto id : marked_) {
+        coreOf_[id] = 0;
+    }
+    marked_.clear();
+    annuli_.clear();
+    cores_ = active_ = 0;
+    if (pool_.size() <= minPool_) {
+        joinRing(pool_);
+        return;
+    }
+
+    // cores are layers of sample, nested ones leave out about
+    // annulusSize_ points of pool between them
+    std::vector<Item> sample;
+    std::vector<unsigned> layer;
+    std::uniform_int_distribution<unsigned> pick(0, pool_.size() - 1);
+    for (unsigned i = 0; i < sampleSize_; i++) {
+        unsigned id = pool_[pick(rng_)];
+        sample.push_back({xar_[id], yar_[id], id});
+    }
+    std::sort(sample.begin(), sample.end());
+    sample.erase(std::unique(sample.begin(), sample.end(),
+                     [](const Item& a, const Item& b) {
+                         return a.id == b.id;
+                     }),
+                 sample.end());
+    unsigned step = std::max(1UL, (unsigned long) sample.size()
+                                  * annulusSize_ / pool_.size()),
+             outside = 0, next = step;
+    std::vector<HullQuery2D> queries;
+    while (!sample.empty()) {
+        boundary(sample, layer);
+        if (outside >= next) {
+            std::vector<point2d_t> pts, hull(2 * layer.size() + 2);
+            for (auto id : layer) {
+                pts.push_back({xar_[id], yar_[id]});
+            }
+            unsigned h = SmallHull2D::hull(pts.data(), pts.size(),
+                                           hull.data());
+            if (h < 3) {
+                break;
+            }
+            Points2D coreHull;
+            for (unsigned i = 0; i < h; i++) {
+                coreHull.add({hull[i].first, hull[i].second});
+            }
+            queries.push_back(HullQuery2D(coreHull));
+            std::sort(hull.begin(), hull.begin() + h);
+            for (auto id : layer) {
+                if (std::binary_search(hull.begin(), hull.begin() + h,
+                                       point2d_t(xar_[id], yar_[id]))) {
+                    coreOf_[id] = queries.size();
+                    marked_.push_back(id);
+                }
+            }
+            next = outside + step;
+        }
+        outside += layer.size();
+        dropMarked(sample);
+    }
+
+    // number of cores strictly containing point, cores are nested
+    cores_ = queries.size();
+    std::vector<unsigned> where(pool_.size());
+    int thr = variant_ == PARA ? omp_get_max_threads() : 1;
+#pragma omp parallel for num_threads(thr) default(shared) schedule(static)
+    for (int i = 0; i < (int) pool_.size(); i++) {
+        unsigned id = pool_[i], lo = 0, hi = cores_;
+        while (lo < hi) {
+            unsigned mid = (lo + hi) / 2;
+            if (queries[mid].locate(xar_[id], yar_[id])
+                == HullQuery2D::INSIDE) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        where[i] = lo;
+    }
+
+    annuli_.resize(cores_ + 1);
+    for (unsigned i = 0; i < pool_.size(); i++) {
+        annuli_[where[i]].push_back(pool_[i]);
+    }
+    pool_.swap(annuli_[cores_]);
+    annuli_[cores_].clear();
+    joinRing(annuli_[0]);
+}
+
+void ConvexLayers2D::nextCore()
+{
+    active_++;
+    if (active_ < cores_) {
+        joinRing(annuli_[active_]);
+    } else {
+        rebuildCores();
+    }
+}
+
+void ConvexLayers2D::joinRing(std::vector<unsigned>& ids)
+{
+    std::vector<Item> items, merged(ring_.size() + ids.size());
+    for (auto id : ids) {
+        items.push_back({xar_[id], yar_[id], id});
+    }
+    std::sort(items.begin(), items.end());
+    std::merge(ring_.begin(), ring_.end(), items.begin(), items.end(),
+               merged.begin());
+    ring_.swap(merged);
+    ids.clear();
+    ids.shrink_to_fit();
+}
+
+void ConvexLayers2D::peel(std::vector<unsigned>& layer)
+{
+    boundary(ring_, layer);
+    dropMarked(ring_);
+}
+
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <omp.h>
+
+#include "lib/structures.h"
+#include "lib/geometry.h"
+#include "solvers/hull_query_2d.h"
+
+namespace ch
+{
+
+/**
+ * Convex layers, also known as onion peeling.
+ *
+ * First layer is hull of all points including points on its edges, every
+ * next one is hull of points left after removing previous layers. Points
+ * strictly inside of convex core polygon with vertices from remaining
+ * points cannot lie on layer until some core vertex is peeled, so layers
+ * are peeled by linear chain passes over sorted points out of core only.
+ * Nested cores are taken from layers of random sample, every point is
+ * placed between two of them by binary search, and when core vertex is
+ * peeled, points between it and next core join the peeled ring. Parallel
+ * version places points in parallel.
+ */
+class ConvexLayers2D
+{
+    public:
+        ConvexLayers2D();
+
+        /** Version switcher, parallel version classifies points in parallel */
+        enum Variant {SEQ, PARA};
+        ConvexLayers2D(Variant v);
+
+        /**
+         * Finds all layers of input
+         *
+         * @param input points
+         * @param layers output, outermost layer first, each in the order
+         *               used by solvers, coincident points appear once
+         * @return Same as layers param, reference to result
+         */
+        std::vector<Points2D>& solve(const Points2D& input,
+                                     std::vector<Points2D>& layers);
+
+        /** Layer of every input point of last solve, 0 for outermost */
+        const std::vector<unsigned>& getDepths() const;
+
+    private:
+        /** Point with its id, sorted by coordinates and id */
+        struct Item {
+            double x, y;
+            unsigned id;
+
+            bool operator<(const Item& o) const {
+                return x < o.x || (x == o.x && (y < o.y
+                                                || (y == o.y && id < o.id)));
+            }
+        };
+
+        /**
+         * Finds points on boundary of hull of sorted points, marks them
+         * by new stamp
+         *
+         * @param sorted sorted points
+         * @param layer output, boundary ids in the order used by solvers
+         */
+        void boundary(const std::vector<Item>& sorted,
+                      std::vector<unsigned>& layer);
+
+        /** Removes points marked by last boundary call */
+        void dropMarked(std::vector<Item>& sorted);
+
+        /**
+         * Builds nested cores from sample of pool and splits pool to
+         * annuli between them, moves all of pool to ring if it is small
+         */
+        void rebuildCores();
+
+        /** Switches to next core after active one lost vertex */
+        void nextCore();
+
+        /** Merges sorted ids to sorted ring */
+        void joinRing(std::vector<unsigned>& ids);
+
+        /** Peels outermost layer of the ring */
+        void peel(std::vector<unsigned>& layer);
+
+        /** Cached coordinates of input */
+        std::vector<double> xar_, yar_;
+
+        std::vector<unsigned> depth_;
+
+        /** Sorted points out of active core, kept with coordinates */
+        std::vector<Item> ring_;
+
+        /** Points inside of all cores */
+        std::vector<unsigned> pool_;
+
+        /**
+         * Points between cores, annulus j lies inside of core j - 1 and
+         * not strictly inside of core j
+         */
+        std::vector<std::vector<unsigned> > annuli_;
+
+        /** Core of every point it is vertex of, plus one, 0 for none */
+        std::vector<unsigned> coreOf_, marked_;
+
+        /** Number of cores and the one all remaining points respect */
+        unsigned cores_, active_;
+
+        /** Marks of points output by boundary, current mark is stamp_ */
+        std::vector<unsigned> seen_;
+        unsigned stamp_;
+
+        /** Target size of annulus, smallest pool to split and sample */
+        unsigned annulusSize_, minPool_, sampleSize_;
+
+        std::mt19937 rng_;
+
+        Variant variant_;
+};
+
+}
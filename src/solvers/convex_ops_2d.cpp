@@ -0,0 +1,352 @@
+#include "solvers/convex_ops_2d.h"
+
+namespace ch
+{
+
+/** Cross product of two vectors */
+static inline double crossVec(const point2d_t& a, const point2d_t& b)
+{
+    return a.first * b.second - a.second * b.first;
+}
+
+Points2D& ConvexOps2D::intersect(const Points2D& a, const Points2D& b,
+                                 Points2D& output)
+{
+    std::vector<point2d_t> pa, pb, result;
+    toCcw(a, pa);
+    toCcw(b, pb);
+    if (pa.empty() || pb.empty()) {
+        return output;
+    }
+    double tol = tolerance(pa, pb);
+
+    if (pa.size() < 3 || pb.size() < 3) {
+        if (pa.size() > pb.size()) {
+            pa.swap(pb);
+        }
+        if (pb.size() >= 3) {
+            clipSmall(pa, pb, tol, result);
+        } else {
+            meetSmall(pa, pb, tol, result);
+        }
+        emit(result, tol, output);
+        return output;
+    }
+
+    std::vector<Line> la, lb, lines(pa.size() + pb.size());
+    edges(pa, la);
+    edges(pb, lb);
+    std::merge(la.begin(), la.end(), lb.begin(), lb.end(), lines.begin(),
+               [](const Line& l, const Line& m) {
+                   return l.angle < m.angle;
+               });
+
+    // half planes sorted by angle, deque keeps those bounding the result
+    std::vector<Line> dq(lines.size());
+    unsigned head = 0, tail = 0;
+    for (auto& l : lines) {
+        while (tail - head > 1
+               && out(l, meet(dq[tail - 1], dq[tail - 2]), tol)) {
+            tail--;
+        }
+        while (tail - head > 1
+               && out(l, meet(dq[head], dq[head + 1]), tol)) {
+            head++;
+        }
+        if (tail > head && fabs(crossVec(l.d, dq[tail - 1].d)) < EPS) {
+            // opposite parallel neighbours leave nothing between them
+            if (dot(l.d, dq[tail - 1].d) < 0) {
+                return output;
+            }
+            if (!out(l, dq[tail - 1].p, 0)) {
+                continue;
+            }
+            tail--;
+        }
+        dq[tail++] = l;
+    }
+    while (tail - head > 2
+           && out(dq[head], meet(dq[tail - 1], dq[tail - 2]), tol)) {
+        tail--;
+    }
+    while (tail - head > 2
+           && out(dq[tail - 1], meet(dq[head], dq[head + 1]), tol)) {
+        head++;
+    }
+    if (tail - head < 3) {
+        return output;
+    }
+
+    for (unsigned i = head; i < tail; i++) {
+        result.push_back(meet(dq[i], dq[i + 1 < tail ? i + 1 : head]));
+    }
+    emit(result, tol, output);
+    return output;
+}
+
+Points2D& ConvexOps2D::minkowskiSum(const Points2D& a, const Points2D& b,
+                                    Points2D& output)
+{
+    std::vector<point2d_t> pa, pb, result;
+    toCcw(a, pa);
+    toCcw(b, pb);
+    if (pa.empty() || pb.empty()) {
+        return output;
+    }
+
+    // both start at lowest vertex, edges are then merged by angle
+    for (auto pts : {&pa, &pb}) {
+        auto lowest = std::min_element(pts->begin(), pts->end(),
+            [](const point2d_t& p, const point2d_t& q) {
+                return p.second < q.second
+                    || (p.second == q.second && p.first < q.first);
+            });
+        std::rotate(pts->begin(), lowest, pts->end());
+    }
+    unsigned n = pa.size(), m = pb.size(), i = 0, j = 0;
+    pa.push_back(pa[0]);
+    pa.push_back(pa[1 % n]);
+    pb.push_back(pb[0]);
+    pb.push_back(pb[1 % m]);
+
+    while (i < n || j < m) {
+        result.push_back(translate(pa[i], pb[j]));
+        double c = crossVec(vectorize(pa[i], pa[i + 1]),
+                            vectorize(pb[j], pb[j + 1]));
+        if (c >= 0 && i < n) {
+            i++;
+        }
+        if (c <= 0 && j < m) {
+            j++;
+        }
+    }
+    emit(result, tolerance(result, result), output);
+    return output;
+}
+
+Points2D& ConvexOps2D::unite(const Points2D& a, const Points2D& b,
+                             Points2D& output)
+{
+    return HullSummary::merge(HullSummary(a), HullSummary(b))
+        .getHull(output);
+}
+
+void ConvexOps2D::applyAll(Operation op, const std::vector<Points2D>& a,
+                           const std::vector<Points2D>& b,
+                           std::vector<Points2D>& output, int thr)
+{
+    if ((unsigned) thr > MAX_NUM_THREADS) {
+        thr = MAX_NUM_THREADS;
+    }
+    if (thr < 1) {
+        thr = 1;
+    }
+    omp_set_num_threads(thr);
+
+    unsigned n = std::min(a.size(), b.size());
+    output.resize(n);
+#pragma omp parallel for default(shared) schedule(dynamic, 64)
+    for (int i = 0; i < (int) n; i++) {
+        output[i].clear();
+        if (op == INTERSECTION) {
+            intersect(a[i], b[i], output[i]);
+        } else if (op == SUM) {
+            minkowskiSum(a[i], b[i], output[i]);
+        } else {
+            unite(a[i], b[i], output[i]);
+        }
+    }
+}
+
+void ConvexOps2D::toCcw(const Points2D& hull, std::vector<point2d_t>& pts)
+{
+    const data_t& data = hull.getData();
+    for (int i = data.size() - 1; i >= 0; i--) {
+        pts.push_back({data[i][0], data[i][1]});
+    }
+}
+
+void ConvexOps2D::emit(const std::vector<point2d_t>& pts, double tol,
+                       Points2D& output)
+{
+    unsigned n = pts.size();
+    if (n == 0) {
+        return;
+    }
+    unsigned lo = 0, hi = 0;
+    for (unsigned i = 1; i < n; i++) {
+        if (pts[i] < pts[lo]) {
+            lo = i;
+        }
+        if (pts[hi] < pts[i]) {
+            hi = i;
+        }
+    }
+
+    // polygon without area is written as segment of its extremes
+    point2d_t axis = vectorize(pts[lo], pts[hi]);
+    double len = sqrt(square(axis));
+    bool flat = true;
+    for (unsigned i = 0; i < n && flat && len > tol; i++) {
+        flat = fabs(crossVec(axis, vectorize(pts[lo], pts[i]))) <= tol * len;
+    }
+    if (flat) {
+        output.add({pts[lo].first, pts[lo].second});
+        if (len > tol) {
+            output.add({pts[hi].first, pts[hi].second});
+        }
+        return;
+    }
+
+    // vertex stays if next one turns left of its edge by more than tol
+    auto turns = [tol](const point2d_t& a, const point2d_t& b,
+                       const point2d_t& c) {
+        point2d_t e = vectorize(a, b);
+        return crossVec(e, vectorize(a, c)) > tol * sqrt(square(e));
+    };
+    std::vector<point2d_t> clean;
+    for (unsigned k = 0; k < n; k++) {
+        const point2d_t& p = pts[(lo + k) % n];
+        if (!clean.empty() && dist(clean.back(), p) <= tol) {
+            continue;
+        }
+        while (clean.size() >= 2
+               && !turns(clean[clean.size() - 2], clean.back(), p)) {
+            clean.pop_back();
+        }
+        clean.push_back(p);
+    }
+    while (clean.size() >= 3
+           && (dist(clean.back(), clean[0]) <= tol
+               || !turns(clean[clean.size() - 2], clean.back(), clean[0]))) {
+        clean.pop_back();
+    }
+
+    // lexicographically smallest vertex is first, then turning right
+    output.add({clean[0].first, clean[0].second});
+    for (unsigned i = clean.size() - 1; i > 0; i--) {
+        output.add({clean[i].first, clean[i].second});
+    }
+}
+
+void ConvexOps2D::edges(const std::vector<point2d_t>& pts,
+                        std::vector<Line>& lines)
+{
+    unsigned n = pts.size(), first = 0;
+    for (unsigned i = 0; i < n; i++) {
+        point2d_t d = vectorize(pts[i], pts[(i + 1) % n]);
+        double len = sqrt(square(d));
+        if (len == 0) {
+            continue;
+        }
+        d = scale(d, 1 / len);
+        lines.push_back({pts[i], d, atan2(d.second, d.first)});
+        if (lines.back().angle < lines[first].angle) {
+            first = lines.size() - 1;
+        }
+    }
+    // angles grow around polygon, list starts at the smallest one
+    std::rotate(lines.begin(), lines.begin() + first, lines.end());
+}
+
+bool ConvexOps2D::out(const Line& l, const point2d_t& r, double tol)
+{
+    return crossVec(l.d, vectorize(l.p, r)) < -tol;
+}
+
+point2d_t ConvexOps2D::meet(const Line& a, const Line& b)
+{
+    double t = crossVec(b.d, vectorize(a.p, b.p)) / crossVec(b.d, a.d);
+    return translate(a.p, scale(a.d, t));
+}
+
+void ConvexOps2D::clipSmall(const std::vector<point2d_t>& small,
+                            const std::vector<point2d_t>& poly, double tol,
+                            std::vector<point2d_t>& result)
+{
+    // parameter range of segment left of every edge
+    const point2d_t& p = small[0];
+    point2d_t d = vectorize(p, small.back());
+    double lo = 0, hi = 1;
+    std::vector<Line> lines;
+    edges(poly, lines);
+    for (auto& l : lines) {
+        double f = crossVec(l.d, vectorize(l.p, p)), fd = crossVec(l.d, d);
+        if (fd == 0) {
+            if (f < -tol) {
+                return;
+            }
+        } else if (fd > 0) {
+            lo = std::max(lo, -f / fd);
+        } else {
+            hi = std::min(hi, -f / fd);
+        }
+    }
+    if ((hi - lo) * sqrt(square(d)) < -tol) {
+        return;
+    }
+    result.push_back(translate(p, scale(d, lo)));
+    if (small.size() > 1) {
+        result.push_back(translate(p, scale(d, std::max(lo, hi))));
+    }
+}
+
+void ConvexOps2D::meetSmall(const std::vector<point2d_t>& a,
+                            const std::vector<point2d_t>& b, double tol,
+                            std::vector<point2d_t>& result)
+{
+    if (b.size() == 1) {
+        if (dist(a[0], b[0]) <= tol) {
+            result.push_back(a[0]);
+        }
+        return;
+    }
+
+    // distances from line of b and positions along it
+    point2d_t u = vectorize(b[0], b[1]);
+    double len = sqrt(square(u));
+    u = scale(u, 1 / len);
+    auto across = [&](const point2d_t& p) {
+        return crossVec(u, vectorize(b[0], p));
+    };
+    auto along = [&](const point2d_t& p) {
+        return dot(u, vectorize(b[0], p));
+    };
+
+    double s0 = across(a[0]), s1 = across(a.back());
+    if (fabs(s0) <= tol && fabs(s1) <= tol) {
+        // collinear, overlap of ranges along b
+        double t0 = along(a[0]), t1 = along(a.back());
+        double lo = std::max(std::min(t0, t1), 0.0),
+               hi = std::min(std::max(t0, t1), len);
+        if (lo <= hi + tol) {
+            result.push_back(translate(b[0], scale(u, lo)));
+            result.push_back(translate(b[0], scale(u, std::max(lo, hi))));
+        }
+        return;
+    }
+    if ((s0 > tol && s1 > tol) || (s0 < -tol && s1 < -tol)) {
+        return;
+    }
+
+    point2d_t x = translate(a[0], scale(vectorize(a[0], a.back()),
+                                        s0 / (s0 - s1)));
+    double t = along(x);
+    if (t >= -tol && t <= len + tol) {
+        result.push_back(x);
+    }
+}
+
+double ConvexOps2D::tolerance(const std::vector<point2d_t>& a,
+                              const std::vector<point2d_t>& b)
+{
+    double size = 1;
+    for (auto pts : {&a, &b}) {
+        for (auto& p : *pts) {
+            size = std::max(size, std::max(fabs(p.first), fabs(p.second)));
+        }
+    }
+    return EPS * size;
+}
+
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <omp.h>
+
+#include "lib/structures.h"
+#include "lib/geometry.h"
+#include "solvers/hull_summary_2d.h"
+
+namespace ch
+{
+
+/**
+ * Operations on computed hulls, in linear time.
+ *
+ * Inputs are hulls in the order produced by solvers, so their edges are
+ * already sorted by angle. Intersection merges edges of both hulls by
+ * angle and intersects their half planes in one pass over a deque,
+ * Minkowski sum merges edges from the lowest vertices, union merges
+ * monotone chains of both hulls. Outputs have the order produced by
+ * solvers, starting at the lexicographically smallest vertex. Hulls of
+ * one or two vertices are taken as point or segment.
+ */
+class ConvexOps2D
+{
+    public:
+        /** Operation applied to pairs of hulls */
+        enum Operation {INTERSECTION, SUM, UNION};
+
+        /**
+         * Finds intersection of two hulls, in O(a + b)
+         *
+         * Hulls of positive area touching only by boundary may give empty
+         * output.
+         *
+         * @param a first hull
+         * @param b second hull
+         * @param output intersection, empty if hulls are disjoint
+         * @return Same as output param, reference to result
+         */
+        static Points2D& intersect(const Points2D& a, const Points2D& b,
+                                   Points2D& output);
+
+        /** Finds Minkowski sum of two hulls, in O(a + b) */
+        static Points2D& minkowskiSum(const Points2D& a, const Points2D& b,
+                                      Points2D& output);
+
+        /** Finds hull of union of two hulls, in O(a + b) */
+        static Points2D& unite(const Points2D& a, const Points2D& b,
+                               Points2D& output);
+
+        /**
+         * Applies operation to many pairs of hulls in parallel
+         *
+         * @param op operation
+         * @param a first hulls of pairs
+         * @param b second hulls of pairs, as many as first ones
+         * @param output results, resized to number of pairs
+         * @param thr number of threads
+         */
+        static void applyAll(Operation op, const std::vector<Points2D>& a,
+                             const std::vector<Points2D>& b,
+                             std::vector<Points2D>& output, int thr);
+
+    private:
+        /** Directed line, half plane on its left side */
+        struct Line {
+            point2d_t p, d;
+            double angle;
+        };
+
+        /** Copies hull counter clockwise, as operations expect */
+        static void toCcw(const Points2D& hull, std::vector<point2d_t>& pts);
+
+        /**
+         * Writes counter clockwise polygon in output order, drops repeated
+         * and collinear vertices
+         */
+        static void emit(const std::vector<point2d_t>& pts, double tol,
+                         Points2D& output);
+
+        /** Edges of counter clockwise polygon as unit lines, by angle */
+        static void edges(const std::vector<point2d_t>& pts,
+                          std::vector<Line>& lines);
+
+        /** Whether point lies right of line, farther than tol */
+        static bool out(const Line& l, const point2d_t& r, double tol);
+
+        /** Intersection of two non parallel lines */
+        static point2d_t meet(const Line& a, const Line& b);
+
+        /**
+         * Clips point or segment by hull of at least 3 vertices
+         *
+         * @param small one or two points
+         * @param poly counter clockwise polygon
+         * @param tol allowed distance of output from poly
+         * @param result ends of clipped part, empty if it misses poly
+         */
+        static void clipSmall(const std::vector<point2d_t>& small,
+                              const std::vector<point2d_t>& poly, double tol,
+                              std::vector<point2d_t>& result);
+
+        /** Intersection of two points or segments */
+        static void meetSmall(const std::vector<point2d_t>& a,
+                              const std::vector<point2d_t>& b, double tol,
+                              std::vector<point2d_t>& result);
+
+        /** Distance tolerance for coordinates of both polygons */
+        static double tolerance(const std::vector<point2d_t>& a,
+                                const std::vector<point2d_t>& b);
+};
+
+}
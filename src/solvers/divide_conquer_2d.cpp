@@ -0,0 +1,306 @@
+#include "solvers/divide_conquer_2d.h"
+
+namespace ch
+{
+
+DivideConquer2D::DivideConquer2D()
+{
+    name_ = "Divide and Conquer";
+    blocks_ = 0;
+    minBlockSize_ = 1000;
+}
+
+DivideConquer2D::DivideConquer2D(unsigned blocks)
+{
+    name_ = "Divide and Conquer";
+    blocks_ = blocks;
+    minBlockSize_ = 1000;
+}
+
+Points2D& DivideConquer2D::solve(const Points2D& input, Points2D& output)
+{
+    SolveScope scope(*this, output);
+    if (input.getSize() <= SmallHull2D::TINY_SIZE) {
+        return scope.delegated(SmallHull2D::solveTiny(input, output));
+    }
+
+    const data_t& inputData = input.getData();
+
+    // splitting does not pay off without threads to solve blocks
+    unsigned threads = omp_get_max_threads(),
+             blocks = blocks_ ? std::min(blocks_, input.getSize())
+                 : threads > 1 ? std::min(4 * threads,
+                       std::max(1U, input.getSize() / minBlockSize_))
+                 : 1;
+    if (blocks <= 1) {
+        Ouellet2D local;
+        return local.solve(input, output);
+    }
+
+    std::vector<unsigned> ids(inputData.size()), bounds;
+    for (unsigned i = 0; i < ids.size(); i++) {
+        ids[i] = i;
+    }
+    bounds.push_back(0);
+    splitBlocks(inputData, ids, 0, ids.size(), blocks, bounds);
+
+    // solve blocks independently
+    std::vector<Chains> hulls(blocks);
+#pragma omp parallel for default(shared) schedule(dynamic)
+    for (int b = 0; b < (int) blocks; b++) {
+        Points2D part, partHull;
+        for (unsigned i = bounds[b]; i < bounds[b + 1]; i++) {
+            part.add(inputData[ids[i]]);
+        }
+        Ouellet2D local;
+        local.solve(part, partHull);
+        toChains(partHull, hulls[b]);
+    }
+
+    // merge neighbouring hulls, one tree level at a time
+    while (hulls.size() > 1) {
+        std::vector<Chains> merged((hulls.size() + 1) / 2);
+#pragma omp parallel for default(shared) schedule(dynamic)
+        for (int i = 0; i < (int) merged.size(); i++) {
+            if (2*i + 1 < (int) hulls.size()) {
+                mergeChains(hulls[2*i], hulls[2*i + 1], merged[i]);
+            } else {
+                merged[i] = hulls[2*i];
+            }
+        }
+        hulls.swap(merged);
+    }
+
+    fromChains(hulls[0], output);
+    return output;
+}
+
+Points2D& DivideConquer2D::merge(const Points2D& left, const Points2D& right,
+                                 Points2D& output)
+{
+    if (left.getSize() == 0) {
+        output = right;
+        return output;
+    }
+    if (right.getSize() == 0) {
+        output = left;
+        return output;
+    }
+
+    Chains leftChains, rightChains, merged;
+    toChains(left, leftChains);
+    toChains(right, rightChains);
+    mergeChains(leftChains, rightChains, merged);
+    fromChains(merged, output);
+    return output;
+}
+
+void DivideConquer2D::toChains(const Points2D& hull, Chains& chains)
+{
+    const data_t& data = hull.getData();
+    unsigned s = data.size();
+    if (s == 0) {
+        return;
+    }
+
+    // lexicographically smallest and largest point, chains share them
+    unsigned lo = 0, hi = 0;
+    for (unsigned i = 1; i < s; i++) {
+        if (data[i][0] < data[lo][0]
+            || (data[i][0] == data[lo][0] && data[i][1] < data[lo][1])) {
+            lo = i;
+        }
+        if (data[i][0] > data[hi][0]
+            || (data[i][0] == data[hi][0] && data[i][1] > data[hi][1])) {
+            hi = i;
+        }
+    }
+
+    // hull goes from left over top to right, and back over bottom
+    for (unsigned i = lo; ; i = (i + 1) % s) {
+        chains.upper.push_back({data[i][0], data[i][1]});
+        if (i == hi) {
+            break;
+        }
+    }
+    for (unsigned i = lo; ; i = (i + s - 1) % s) {
+        chains.lower.push_back({data[i][0], data[i][1]});
+        if (i == hi) {
+            break;
+        }
+    }
+}
+
+void DivideConquer2D::fromChains(const Chains& chains, Points2D& output)
+{
+    const std::vector<point2d_t>& upper = chains.upper,
+                                & lower = chains.lower;
+    for (auto& pt : upper) {
+        emit(output, {pt.first, pt.second});
+    }
+    for (int i = (int) lower.size() - 1; i >= 0; i--) {
+        if (   (i == (int) lower.size() - 1 && lower[i] == upper.back())
+            || (i == 0 && lower[i] == upper.front())) {
+            continue;
+        }
+        emit(output, {lower[i].first, lower[i].second});
+    }
+}
+
+void DivideConquer2D::mergeChains(const Chains& left, const Chains& right,
+                                  Chains& output)
+{
+    if (left.upper.back() == right.upper.front()) {
+        // duplicate point on block boundary, drop it from right hull
+        if (right.upper.size() == 1) {
+            output = left;
+            return;
+        }
+        Chains rest;
+        rest.upper.assign(right.upper.begin() + 1, right.upper.end());
+        rest.lower.assign(right.lower.begin() + 1, right.lower.end());
+        mergeChains(left, rest, output);
+        return;
+    }
+
+    std::pair<unsigned, unsigned> up  = findBridge(left.upper, right.upper, 1),
+                                  low = findBridge(left.lower, right.lower, -1);
+
+    output.upper.assign(left.upper.begin(), left.upper.begin() + up.first + 1);
+    output.upper.insert(output.upper.end(),
+                        right.upper.begin() + up.second, right.upper.end());
+    output.lower.assign(left.lower.begin(), left.lower.begin() + low.first + 1);
+    output.lower.insert(output.lower.end(),
+                        right.lower.begin() + low.second, right.lower.end());
+}
+
+std::pair<unsigned, unsigned> DivideConquer2D::findBridge(
+        const std::vector<point2d_t>& left,
+        const std::vector<point2d_t>& right, double sign)
+{
+    // cross product of points mirrored by sign, positive if c is above ab
+    auto side = [sign](const point2d_t& a, const point2d_t& b,
+                       const point2d_t& c) {
+        return cross(a.first, sign * a.second, b.first, sign * b.second,
+                     c.first, sign * c.second);
+    };
+
+    unsigned aLo = 0, aHi = left.size() - 1,
+             bLo = 0, bHi = right.size() - 1;
+    // point between both chains, blocks can share x coordinate
+    double sepX = (left.back().first + right.front().first) / 2,
+           sepY = (left.back().second + right.front().second) / 2;
+
+    while (aLo <= aHi && bLo <= bHi) {
+        unsigned ma = (aLo + aHi) / 2, mb = (bLo + bHi) / 2;
+        const point2d_t& a = left[ma], & b = right[mb];
+        bool aLeft  = ma > 0 && side(a, b, left[ma - 1]) > EPS,
+             aRight = ma + 1 < left.size() && side(a, b, left[ma + 1]) > EPS,
+             bLeft  = mb > 0 && side(a, b, right[mb - 1]) > EPS,
+             bRight = mb + 1 < right.size()
+                      && side(a, b, right[mb + 1]) > EPS;
+
+        if (!aLeft && !aRight && !bLeft && !bRight) {
+            // take outermost of collinear points
+            while (ma > 0 && fabs(side(a, b, left[ma - 1])) <= EPS) {
+                ma--;
+            }
+            while (mb + 1 < right.size()
+                   && fabs(side(a, b, right[mb + 1])) <= EPS) {
+                mb++;
+            }
+            return {ma, mb};
+        }
+
+        if (aLeft || bRight) {
+            // bridge lies left of a, or right of b
+            if (aLeft) {
+                aHi = ma - 1;
+            }
+            if (bRight) {
+                bLo = mb + 1;
+            }
+        } else if (!aRight) {
+            bHi = mb - 1;
+        } else if (!bLeft) {
+            aLo = ma + 1;
+        } else {
+            // both points see over their inner neighbours, decide by
+            // intersection of their edges with respect to separating line,
+            // its offsets from line are kept scaled by cross product of
+            // edges, so nothing is divided
+            const point2d_t& a2 = left[ma + 1], & b1 = right[mb - 1];
+            double d1x = a2.first - a.first, d1y = a2.second - a.second,
+                   d2x = b.first - b1.first, d2y = b.second - b1.second,
+                   den = d1x * d2y - d1y * d2x,
+                   num = (b1.first - a.first) * d2y
+                         - (b1.second - a.second) * d2x;
+            if (fabs(den) <= EPS) {
+                // parallel edges, left to linear search
+                break;
+            }
+            double dir = den > 0 ? 1 : -1, tol = EPS * fabs(den),
+                   offX = dir * ((a.first - sepX) * den + num * d1x),
+                   offY = dir * ((a.second - sepY) * den + num * d1y);
+            if (offX < -tol || (fabs(offX) <= tol && offY <= 0)) {
+                aLo = ma + 1;
+            } else {
+                bHi = mb - 1;
+            }
+        }
+    }
+
+    R("bridge fallback")
+    return findBridgeScan(left, right, sign);
+}
+
+std::pair<unsigned, unsigned> DivideConquer2D::findBridgeScan(
+        const std::vector<point2d_t>& left,
+        const std::vector<point2d_t>& right, double sign)
+{
+    auto side = [sign](const point2d_t& a, const point2d_t& b,
+                       const point2d_t& c) {
+        return cross(a.first, sign * a.second, b.first, sign * b.second,
+                     c.first, sign * c.second);
+    };
+
+    unsigned ma = left.size() - 1, mb = 0;
+    bool moved = 1;
+    while (moved) {
+        moved = 0;
+        while (ma > 0 && side(left[ma], right[mb], left[ma - 1]) > -EPS) {
+            ma--;
+            moved = 1;
+        }
+        while (mb + 1 < right.size()
+               && side(left[ma], right[mb], right[mb + 1]) > -EPS) {
+            mb++;
+            moved = 1;
+        }
+    }
+    return {ma, mb};
+}
+
+void DivideConquer2D::splitBlocks(const data_t& input,
+                                  std::vector<unsigned>& ids,
+                                  unsigned from, unsigned to, unsigned blocks,
+                                  std::vector<unsigned>& bounds)
+{
+    if (blocks <= 1) {
+        bounds.push_back(to);
+        return;
+    }
+
+    unsigned half = blocks / 2,
+             mid = from + (unsigned long long) (to - from) * half / blocks;
+    std::nth_element(ids.begin() + from, ids.begin() + mid, ids.begin() + to,
+        [&input](unsigned a, unsigned b) {
+            return input[a][0] < input[b][0]
+                || (input[a][0] == input[b][0] && input[a][1] < input[b][1]);
+        });
+
+    splitBlocks(input, ids, from, mid, half, bounds);
+    splitBlocks(input, ids, mid, to, blocks - half, bounds);
+}
+
+}
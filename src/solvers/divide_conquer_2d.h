@@ -0,0 +1,100 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <omp.h>
+
+#include "lib/structures.h"
+#include "lib/geometry.h"
+#include "solvers/solver_2d.h"
+#include "solvers/small_hull_2d.h"
+#include "solvers/ouellet_2d.h"
+
+namespace ch
+{
+
+/**
+ * Parallel divide and conquer solver.
+ *
+ * Input is split by x coordinate into blocks, which are solved
+ * independently by sequential solver. Hulls of neighbouring blocks are then
+ * merged pairwise in parallel tree, using upper and lower bridges found in
+ * O(log h).
+ */
+class DivideConquer2D : public Solver2D
+{
+    public:
+        DivideConquer2D();
+
+        /**
+         * Constructor.
+         *
+         * @param blocks number of blocks input is split to, zero to use
+         *               four blocks per available thread (only on
+         *               large enough inputs and with more threads)
+         */
+        DivideConquer2D(unsigned blocks);
+
+        Points2D& solve(const Points2D& input, Points2D& output);
+
+        /**
+         * Merges two hulls separated by vertical line
+         *
+         * Hulls are expected in the order and form produced by solvers,
+         * without collinear points, with left one lying entirely left of
+         * the right one (touching line is allowed).
+         *
+         * @param left hull of left point set
+         * @param right hull of right point set
+         * @param output hull of union of both sets
+         * @return Same as output param, reference to result
+         */
+        Points2D& merge(const Points2D& left, const Points2D& right,
+                        Points2D& output);
+
+    private:
+        /** Hull split to upper and lower chain, both ordered by x */
+        struct Chains {
+            std::vector<point2d_t> upper, lower;
+        };
+
+        /** Splits solver output to chains */
+        void toChains(const Points2D& hull, Chains& chains);
+
+        /** Joins chains back to ordered hull */
+        void fromChains(const Chains& chains, Points2D& output);
+
+        /** Merges chains of neighbouring hulls */
+        void mergeChains(const Chains& left, const Chains& right,
+                         Chains& output);
+
+        /**
+         * Finds upper bridge of two chains by simultaneous binary search
+         *
+         * @param left upper chain of left hull
+         * @param right upper chain of right hull
+         * @param sign -1 to find lower bridge of lower chains
+         * @return indices of bridge endpoints in left and right chain
+         */
+        std::pair<unsigned, unsigned> findBridge(
+                const std::vector<point2d_t>& left,
+                const std::vector<point2d_t>& right, double sign);
+
+        /** Linear bridge search, used when binary search fails on precision */
+        std::pair<unsigned, unsigned> findBridgeScan(
+                const std::vector<point2d_t>& left,
+                const std::vector<point2d_t>& right, double sign);
+
+        /** Splits ids to blocks by x coordinate, using selection */
+        void splitBlocks(const data_t& input, std::vector<unsigned>& ids,
+                         unsigned from, unsigned to, unsigned blocks,
+                         std::vector<unsigned>& bounds);
+
+        /** Requested number of blocks */
+        unsigned blocks_;
+
+        /** Minimal number of points in one block */
+        unsigned minBlockSize_;
+};
+
+}
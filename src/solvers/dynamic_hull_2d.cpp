@@ -0,0 +1,196 @@
+#include "solvers/dynamic_hull_2d.h"
+
+namespace ch
+{
+
+DynamicHull2D::DynamicHull2D()
+{
+}
+
+bool DynamicHull2D::insert(const point2d_t& pt)
+{
+    bool up = upper_.insert(pt.first, pt.second),
+         low = lower_.insert(pt.first, -pt.second);
+    return up || low;
+}
+
+bool DynamicHull2D::contains(const point2d_t& pt) const
+{
+    return upper_.below(pt.first, pt.second)
+        && lower_.below(pt.first, -pt.second);
+}
+
+point2d_t DynamicHull2D::extreme(double dx, double dy) const
+{
+    if (dy > 0) {
+        return upper_.extreme(dx, dy);
+    }
+    if (dy < 0) {
+        point2d_t pt = lower_.extreme(dx, -dy);
+        return {pt.first, -pt.second};
+    }
+    // horizontal direction, any vertex with extreme x
+    if (dx < 0) {
+        return *upper_.pts_.begin();
+    }
+    return *upper_.pts_.rbegin();
+}
+
+unsigned DynamicHull2D::getSize() const
+{
+    unsigned size = upper_.pts_.size() + lower_.pts_.size();
+    if (size == 0) {
+        return 0;
+    }
+
+    // endpoints are shared, unless there is vertical edge
+    const point2d_t& ul = *upper_.pts_.begin(), & ur = *upper_.pts_.rbegin(),
+                   & ll = *lower_.pts_.begin(), & lr = *lower_.pts_.rbegin();
+    size -= ul.second == -ll.second;
+    if (upper_.pts_.size() > 1) {
+        size -= ur.second == -lr.second;
+    }
+    return size;
+}
+
+void DynamicHull2D::clear()
+{
+    upper_.pts_.clear();
+    upper_.edges_.clear();
+    lower_.pts_.clear();
+    lower_.edges_.clear();
+}
+
+Points2D& DynamicHull2D::getHull(Points2D& output) const
+{
+    if (upper_.pts_.empty()) {
+        return output;
+    }
+
+    // upper hull from left to right, then lower one back
+    for (auto& pt : upper_.pts_) {
+        output.add({pt.first, pt.second});
+    }
+    auto first = lower_.pts_.rbegin(), last = --lower_.pts_.rend();
+    for (auto it = first; ; ++it) {
+        bool shared = (it == first && upper_.pts_.rbegin()->second
+                                      == -it->second)
+                   || (it == last && upper_.pts_.begin()->second
+                                     == -it->second);
+        if (!shared) {
+            output.add({it->first, -it->second});
+        }
+        if (it == last) {
+            break;
+        }
+    }
+    return output;
+}
+
+bool DynamicHull2D::Chain::insert(double x, double y)
+{
+    iter_t right = pts_.lower_bound(x);
+    if (right != pts_.end() && right->first == x) {
+        if (y <= right->second) {
+            return false;
+        }
+        erase(right);
+        right = pts_.lower_bound(x);
+    } else if (right != pts_.end() && right != pts_.begin()) {
+        iter_t left = std::prev(right);
+        if (cross(left->first, left->second, right->first, right->second,
+                  x, y) <= EPS) {
+            // on or below edge
+            return false;
+        }
+        removeEdge(left, right);
+    }
+
+    iter_t it = pts_.insert(right, {x, y});
+
+    // remove neighbours which stopped turning right
+    while (it != pts_.begin() && std::prev(it) != pts_.begin()) {
+        iter_t a = std::prev(std::prev(it)), b = std::prev(it);
+        if (cross(a->first, a->second, b->first, b->second, x, y) < -EPS) {
+            break;
+        }
+        erase(b);
+    }
+    while (std::next(it) != pts_.end()
+           && std::next(std::next(it)) != pts_.end()) {
+        iter_t b = std::next(it), c = std::next(b);
+        if (cross(x, y, b->first, b->second, c->first, c->second) < -EPS) {
+            break;
+        }
+        erase(b);
+    }
+
+    if (it != pts_.begin()) {
+        addEdge(std::prev(it), it);
+    }
+    if (std::next(it) != pts_.end()) {
+        addEdge(it, std::next(it));
+    }
+    return true;
+}
+
+bool DynamicHull2D::Chain::below(double x, double y) const
+{
+    if (pts_.empty() || x < pts_.begin()->first
+        || x > pts_.rbegin()->first) {
+        return false;
+    }
+
+    auto right = pts_.lower_bound(x);
+    if (right->first == x) {
+        return y <= right->second + EPS;
+    }
+    auto left = std::prev(right);
+    return cross(left->first, left->second, right->first, right->second,
+                 x, y) <= EPS;
+}
+
+point2d_t DynamicHull2D::Chain::extreme(double dx, double dy) const
+{
+    // moving along edge pays off while its slope is above -dx / dy
+    auto it = edges_.upper_bound(-dx / dy);
+    if (it == edges_.begin()) {
+        return *pts_.rbegin();
+    }
+    --it;
+    return *pts_.find(it->second);
+}
+
+void DynamicHull2D::Chain::erase(iter_t it)
+{
+    if (it != pts_.begin()) {
+        removeEdge(std::prev(it), it);
+    }
+    if (std::next(it) != pts_.end()) {
+        removeEdge(it, std::next(it));
+    }
+    pts_.erase(it);
+}
+
+double DynamicHull2D::Chain::slope(iter_t a, iter_t b)
+{
+    return (b->second - a->second) / (b->first - a->first);
+}
+
+void DynamicHull2D::Chain::addEdge(iter_t a, iter_t b)
+{
+    edges_.insert({slope(a, b), a->first});
+}
+
+void DynamicHull2D::Chain::removeEdge(iter_t a, iter_t b)
+{
+    auto range = edges_.equal_range(slope(a, b));
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == a->first) {
+            edges_.erase(it);
+            return;
+        }
+    }
+}
+
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <map>
+
+#include "lib/structures.h"
+#include "lib/geometry.h"
+
+namespace ch
+{
+
+/**
+ * Convex hull maintained under insertion of points.
+ *
+ * Upper and lower hull are kept in ordered maps by x coordinate, along with
+ * maps of their edge slopes. Insertion takes O(log h) amortized time,
+ * point location and extreme point in direction O(log h).
+ */
+class DynamicHull2D
+{
+    public:
+        DynamicHull2D();
+
+        /**
+         * Adds point to set
+         *
+         * @param pt inserted point
+         * @return true if point changed the hull
+         */
+        bool insert(const point2d_t& pt);
+
+        /** Finds out if point lies inside of hull or on its border */
+        bool contains(const point2d_t& pt) const;
+
+        /**
+         * Finds hull vertex farthest in given direction
+         *
+         * Hull must not be empty.
+         *
+         * @param dx x coordinate of direction
+         * @param dy y coordinate of direction
+         * @return vertex with maximal dot product with direction
+         */
+        point2d_t extreme(double dx, double dy) const;
+
+        /** Number of hull vertices */
+        unsigned getSize() const;
+
+        /** Removes all points */
+        void clear();
+
+        /**
+         * Writes hull in the order used by solvers
+         *
+         * @param output hull vertices are added to it
+         * @return Same as output param, reference to result
+         */
+        Points2D& getHull(Points2D& output) const;
+
+    private:
+        /**
+         * Upper hull from left to right, lower hull is kept as upper hull
+         * of points mirrored by x axis
+         */
+        class Chain
+        {
+            public:
+                /** Inserts point, returns true if chain changed */
+                bool insert(double x, double y);
+
+                /** Whether point lies on or below chain, in its x range */
+                bool below(double x, double y) const;
+
+                /** Vertex maximizing dot product with (dx, dy), dy > 0 */
+                point2d_t extreme(double dx, double dy) const;
+
+                /** Vertices by x coordinate */
+                std::map<double, double> pts_;
+
+                /** Left endpoints of edges by slope, slopes decrease in x */
+                std::multimap<double, double> edges_;
+
+            private:
+                typedef std::map<double, double>::iterator iter_t;
+
+                /** Removes vertex with its edges */
+                void erase(iter_t it);
+
+                /** Slope of edge, same key is used to insert and remove it */
+                static double slope(iter_t a, iter_t b);
+
+                void addEdge(iter_t a, iter_t b);
+                void removeEdge(iter_t a, iter_t b);
+        };
+
+        Chain upper_, lower_;
+};
+
+}
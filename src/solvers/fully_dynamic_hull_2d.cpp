@@ -0,0 +1,345 @@
+#include "solvers/fully_dynamic_hull_2d.h"
+
+namespace ch
+{
+
+const double FullyDynamicHull2D::ALPHA = 0.75;
+
+FullyDynamicHull2D::FullyDynamicHull2D()
+{
+    root_ = -1;
+}
+
+unsigned FullyDynamicHull2D::insert(const point2d_t& pt)
+{
+    unsigned id;
+    if (freeIds_.empty()) {
+        id = pts_.size();
+        pts_.push_back(pt);
+        leaf_.push_back(-1);
+    } else {
+        id = freeIds_.back();
+        freeIds_.pop_back();
+        pts_[id] = pt;
+    }
+    insertLeaf(id);
+    return id;
+}
+
+void FullyDynamicHull2D::remove(unsigned id)
+{
+    removeLeaf(id);
+    freeIds_.push_back(id);
+}
+
+void FullyDynamicHull2D::move(unsigned id, const point2d_t& pt)
+{
+    removeLeaf(id);
+    pts_[id] = pt;
+    insertLeaf(id);
+}
+
+const point2d_t& FullyDynamicHull2D::getPoint(unsigned id) const
+{
+    return pts_[id];
+}
+
+unsigned FullyDynamicHull2D::getSize() const
+{
+    return root_ < 0 ? 0 : nodes_[root_].size;
+}
+
+void FullyDynamicHull2D::clear()
+{
+    nodes_.clear();
+    freeNodes_.clear();
+    root_ = -1;
+    pts_.clear();
+    leaf_.clear();
+    freeIds_.clear();
+}
+
+Points2D& FullyDynamicHull2D::getHull(Points2D& output) const
+{
+    std::vector<unsigned> ids;
+    getHullIds(ids);
+    for (auto id : ids) {
+        output.add({pts_[id].first, pts_[id].second});
+    }
+    return output;
+}
+
+std::vector<unsigned>& FullyDynamicHull2D::getHullIds(
+        std::vector<unsigned>& output) const
+{
+    if (root_ < 0) {
+        return output;
+    }
+
+    std::vector<unsigned> upper, lower;
+    collect(root_, 0, -1, -1, upper);
+    collect(root_, 1, -1, -1, lower);
+
+    // upper chain forward and lower back, chains share their ends; equal
+    // points are reported once
+    unsigned first = output.size();
+    for (auto id : upper) {
+        if (output.size() == first || pts_[output.back()] != pts_[id]) {
+            output.push_back(id);
+        }
+    }
+    for (int i = (int) lower.size() - 2; i > 0; i--) {
+        if (pts_[output.back()] != pts_[lower[i]]) {
+            output.push_back(lower[i]);
+        }
+    }
+    if (output.size() - first > 1 && pts_[output.back()] == pts_[output[first]]) {
+        output.pop_back();
+    }
+    return output;
+}
+
+bool FullyDynamicHull2D::less(unsigned a, unsigned b) const
+{
+    return pts_[a] < pts_[b] || (pts_[a] == pts_[b] && a < b);
+}
+
+double FullyDynamicHull2D::side(unsigned a, unsigned b, unsigned c,
+                                int k) const
+{
+    double res = cross(pts_[a].first, pts_[a].second,
+                       pts_[b].first, pts_[b].second,
+                       pts_[c].first, pts_[c].second);
+    return k ? -res : res;
+}
+
+unsigned FullyDynamicHull2D::tangent(unsigned p, int v, int k) const
+{
+    // walk down to the side of bridge tangent touches, collinear points
+    // are skipped to the farthest one
+    int lo = -1, hi = -1;
+    while (nodes_[v].left >= 0) {
+        const unsigned* b = nodes_[v].bridge[k];
+        int forced = bounded(b, lo, hi);
+        v = descend(v, k, forced ? forced > 0 : side(p, b[0], b[1], k) > -EPS,
+                    lo, hi);
+    }
+    return nodes_[v].minId;
+}
+
+void FullyDynamicHull2D::findBridge(Node& node, int k) const
+{
+    // left endpoint of bridge is the first vertex of left hull, whose
+    // successor lies below tangent to right hull
+    int v = node.left, lo = -1, hi = -1;
+    while (nodes_[v].left >= 0) {
+        const unsigned* b = nodes_[v].bridge[k];
+        int forced = bounded(b, lo, hi);
+        bool right = forced > 0;
+        if (!forced) {
+            unsigned t = tangent(b[0], node.right, k);
+            right = side(b[0], t, b[1], k) > EPS;
+        }
+        v = descend(v, k, right, lo, hi);
+    }
+    node.bridge[k][0] = nodes_[v].minId;
+    node.bridge[k][1] = tangent(node.bridge[k][0], node.right, k);
+}
+
+int FullyDynamicHull2D::bounded(const unsigned* bridge, int lo, int hi) const
+{
+    if (hi >= 0 && less(hi, bridge[1])) {
+        return -1;
+    }
+    if (lo >= 0 && less(bridge[0], lo)) {
+        return 1;
+    }
+    return 0;
+}
+
+int FullyDynamicHull2D::descend(int v, int k, bool right, int& lo,
+                                int& hi) const
+{
+    const unsigned* b = nodes_[v].bridge[k];
+    if (right) {
+        if (lo < 0 || less(lo, b[1])) {
+            lo = b[1];
+        }
+        return nodes_[v].right;
+    }
+    if (hi < 0 || less(b[0], hi)) {
+        hi = b[0];
+    }
+    return nodes_[v].left;
+}
+
+void FullyDynamicHull2D::update(int v)
+{
+    Node& node = nodes_[v];
+    const Node& l = nodes_[node.left], & r = nodes_[node.right];
+    node.size = l.size + r.size;
+    node.minId = l.minId;
+    node.maxId = r.maxId;
+    findBridge(node, 0);
+    findBridge(node, 1);
+}
+
+void FullyDynamicHull2D::insertLeaf(unsigned id)
+{
+    int leaf = newNode();
+    nodes_[leaf].left = nodes_[leaf].right = -1;
+    nodes_[leaf].size = 1;
+    nodes_[leaf].minId = nodes_[leaf].maxId = id;
+    leaf_[id] = leaf;
+
+    if (root_ < 0) {
+        nodes_[leaf].parent = -1;
+        root_ = leaf;
+        return;
+    }
+
+    int v = root_;
+    while (nodes_[v].left >= 0) {
+        v = less(id, nodes_[nodes_[v].left].maxId) ? nodes_[v].left
+                                                   : nodes_[v].right;
+    }
+
+    // leaf v is split to inner node with both points
+    int u = newNode();
+    nodes_[u].parent = nodes_[v].parent;
+    relink(nodes_[v].parent, v, u);
+    if (less(id, nodes_[v].minId)) {
+        nodes_[u].left = leaf;
+        nodes_[u].right = v;
+    } else {
+        nodes_[u].left = v;
+        nodes_[u].right = leaf;
+    }
+    nodes_[leaf].parent = nodes_[v].parent = u;
+    fixUp(u);
+}
+
+void FullyDynamicHull2D::removeLeaf(unsigned id)
+{
+    int v = leaf_[id], p = nodes_[v].parent;
+    leaf_[id] = -1;
+    freeNodes_.push_back(v);
+    if (p < 0) {
+        root_ = -1;
+        return;
+    }
+
+    // sibling takes place of parent
+    int s = nodes_[p].left == v ? nodes_[p].right : nodes_[p].left,
+        g = nodes_[p].parent;
+    nodes_[s].parent = g;
+    relink(g, p, s);
+    freeNodes_.push_back(p);
+    if (g >= 0) {
+        fixUp(g);
+    }
+}
+
+void FullyDynamicHull2D::fixUp(int v)
+{
+    int scapegoat = -1;
+    for (int u = v; u >= 0; u = nodes_[u].parent) {
+        Node& node = nodes_[u];
+        node.size = nodes_[node.left].size + nodes_[node.right].size;
+        node.minId = nodes_[node.left].minId;
+        node.maxId = nodes_[node.right].maxId;
+        if (std::max(nodes_[node.left].size, nodes_[node.right].size)
+            > ALPHA * node.size) {
+            scapegoat = u;
+        }
+    }
+
+    // rebuilt subtree has bridges computed, its ancestors need new ones
+    if (scapegoat >= 0) {
+        int p = nodes_[scapegoat].parent;
+        rebuild(scapegoat);
+        v = p;
+    }
+    for (int u = v; u >= 0; u = nodes_[u].parent) {
+        update(u);
+    }
+}
+
+void FullyDynamicHull2D::rebuild(int v)
+{
+    std::vector<int> leaves;
+    int p = nodes_[v].parent;
+    collectLeaves(v, leaves);
+    int u = build(leaves, 0, leaves.size());
+    nodes_[u].parent = p;
+    relink(p, v, u);
+}
+
+void FullyDynamicHull2D::collectLeaves(int v, std::vector<int>& leaves)
+{
+    if (nodes_[v].left < 0) {
+        leaves.push_back(v);
+        return;
+    }
+    collectLeaves(nodes_[v].left, leaves);
+    collectLeaves(nodes_[v].right, leaves);
+    freeNodes_.push_back(v);
+}
+
+int FullyDynamicHull2D::build(std::vector<int>& leaves, unsigned from,
+                              unsigned to)
+{
+    if (to - from == 1) {
+        return leaves[from];
+    }
+    unsigned mid = (from + to) / 2;
+    int l = build(leaves, from, mid), r = build(leaves, mid, to);
+    int u = newNode();
+    nodes_[u].left = l;
+    nodes_[u].right = r;
+    nodes_[l].parent = nodes_[r].parent = u;
+    update(u);
+    return u;
+}
+
+void FullyDynamicHull2D::relink(int parent, int old, int v)
+{
+    if (parent < 0) {
+        root_ = v;
+    } else if (nodes_[parent].left == old) {
+        nodes_[parent].left = v;
+    } else {
+        nodes_[parent].right = v;
+    }
+}
+
+int FullyDynamicHull2D::newNode()
+{
+    if (freeNodes_.empty()) {
+        nodes_.push_back(Node());
+        return nodes_.size() - 1;
+    }
+    int v = freeNodes_.back();
+    freeNodes_.pop_back();
+    return v;
+}
+
+void FullyDynamicHull2D::collect(int v, int k, int lo, int hi,
+                                 std::vector<unsigned>& chain) const
+{
+    const Node& node = nodes_[v];
+    if ((lo >= 0 && less(node.maxId, lo)) || (hi >= 0 && less(hi, node.minId))) {
+        return;
+    }
+    if (node.left < 0) {
+        chain.push_back(node.minId);
+        return;
+    }
+
+    // hull of subtree is left hull up to bridge and right hull after it
+    unsigned bl = node.bridge[k][0], br = node.bridge[k][1];
+    collect(node.left, k, lo, hi >= 0 && less(hi, bl) ? hi : bl, chain);
+    collect(node.right, k, lo >= 0 && less(br, lo) ? lo : br, hi, chain);
+}
+
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+#include "lib/structures.h"
+#include "lib/geometry.h"
+
+namespace ch
+{
+
+/**
+ * Convex hull maintained under insertion and deletion of points.
+ *
+ * Hull tree in the spirit of Overmars and van Leeuwen. Points are kept in
+ * leaves of weight balanced tree ordered by coordinates, every inner node
+ * stores bridges of upper and lower hulls of its two subtrees. Hull of any
+ * subtree is thus given implicitly and bridge of parent is found by nested
+ * binary search over children in O(log^2 n). Updates recompute bridges on
+ * path to root in O(log^3 n) amortized, hull is read in O(h log n).
+ */
+class FullyDynamicHull2D
+{
+    public:
+        FullyDynamicHull2D();
+
+        /**
+         * Adds point to set
+         *
+         * @param pt inserted point
+         * @return id of point, valid until it is removed
+         */
+        unsigned insert(const point2d_t& pt);
+
+        /** Removes point with given id */
+        void remove(unsigned id);
+
+        /** Changes coordinates of point, keeping its id */
+        void move(unsigned id, const point2d_t& pt);
+
+        /** Coordinates of point with given id */
+        const point2d_t& getPoint(unsigned id) const;
+
+        /** Number of points in set */
+        unsigned getSize() const;
+
+        /** Removes all points */
+        void clear();
+
+        /**
+         * Writes hull in the order used by solvers
+         *
+         * @param output hull vertices are added to it
+         * @return Same as output param, reference to result
+         */
+        Points2D& getHull(Points2D& output) const;
+
+        /**
+         * Writes ids of hull vertices, in the same order as getHull
+         *
+         * @param output ids are appended to it
+         * @return Same as output param, reference to result
+         */
+        std::vector<unsigned>& getHullIds(std::vector<unsigned>& output) const;
+
+    private:
+        /** Tree node, leaves have no children and hold one point */
+        struct Node {
+            int parent, left, right;
+            unsigned size;
+
+            /** Point of leaf, or smallest and largest point of subtree */
+            unsigned minId, maxId;
+
+            /** Upper [0] and lower [1] bridge, ids of its endpoints */
+            unsigned bridge[2][2];
+        };
+
+        /** Whether point a precedes point b, by x, y and id */
+        bool less(unsigned a, unsigned b) const;
+
+        /** Cross product of points, mirrored by x axis for lower hull */
+        double side(unsigned a, unsigned b, unsigned c, int k) const;
+
+        /** Point of hull k of subtree v tangent from point p left of it */
+        unsigned tangent(unsigned p, int v, int k) const;
+
+        /**
+         * Checks if bridge lies out of part of node hull,
+         * which belongs to hull of ancestor
+         *
+         * @param lo first point of the part, -1 for no bound
+         * @param hi last point of the part, -1 for no bound
+         * @return -1 if part lies left of bridge, 1 if right, otherwise 0
+         */
+        int bounded(const unsigned* bridge, int lo, int hi) const;
+
+        /** Moves to child of inner node and narrows bounds of hull part */
+        int descend(int v, int k, bool right, int& lo, int& hi) const;
+
+        /** Finds bridge k of children of inner node */
+        void findBridge(Node& node, int k) const;
+
+        /** Recomputes node data from its children */
+        void update(int v);
+
+        /** Hangs point to tree and updates path to root */
+        void insertLeaf(unsigned id);
+
+        /** Cuts leaf of point from tree and updates path to root */
+        void removeLeaf(unsigned id);
+
+        /**
+         * Recomputes sizes on path from v to root, rebalances highest
+         * unbalanced subtree and recomputes bridges above it
+         */
+        void fixUp(int v);
+
+        /** Rebuilds subtree into perfectly balanced one */
+        void rebuild(int v);
+        void collectLeaves(int v, std::vector<int>& leaves);
+        int build(std::vector<int>& leaves, unsigned from, unsigned to);
+
+        /** Replaces child pointer of parent of old node */
+        void relink(int parent, int old, int v);
+
+        int newNode();
+
+        /**
+         * Collects ids of chain k of subtree v between given points
+         *
+         * @param lo first point to output, -1 for no bound
+         * @param hi last point to output, -1 for no bound
+         */
+        void collect(int v, int k, int lo, int hi,
+                     std::vector<unsigned>& chain) const;
+
+        std::vector<Node> nodes_;
+        std::vector<int> freeNodes_;
+        int root_;
+
+        /** Coordinates and leaf of every point id, leaf is -1 if unused */
+        std::vector<point2d_t> pts_;
+        std::vector<int> leaf_;
+        std::vector<unsigned> freeIds_;
+
+        /** Maximal share of subtree size in one child */
+        static const double ALPHA;
+};
+
+}
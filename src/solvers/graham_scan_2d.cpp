@@ -17,6 +17,11 @@ GrahamScan2D::GrahamScan2D(Variant v)
 
 Points2D& GrahamScan2D::solve(const Points2D& input, Points2D& output)
 {
+    SolveScope scope(*this, output);
+    if (input.getSize() <= SmallHull2D::TINY_SIZE) {
+        return scope.delegated(SmallHull2D::solveTiny(input, output));
+    }
+
     switch (variant_) {
         case SEQ:
             return solveSequential(input, output);
@@ -46,9 +51,7 @@ Points2D& GrahamScan2D::solveSequential(const Points2D& input,
 
     unsigned * ptStack = new unsigned[inputData.size()];
     unsigned stackSize = scan(inputData, ptStack);
-    for (unsigned i = 0; i < stackSize; i++) {
-        output.add(inputData[ptStack[i]]);
-    }
+    emitStack(inputData, ptStack, stackSize, output);
     delete[] ptStack;
 
     return output;
@@ -73,9 +76,7 @@ Points2D& GrahamScan2D::solveParallel(const Points2D& input, Points2D& output)
 
     unsigned * ptStack = new unsigned[inputData.size()];
     unsigned stackSize = scan(inputData, ptStack);
-    for (unsigned i = 0; i < stackSize; i++) {
-        output.add(inputData[ptStack[i]]);
-    }
+    emitStack(inputData, ptStack, stackSize, output);
     delete[] ptStack;
 
     return output;
@@ -139,7 +140,13 @@ void GrahamScan2D::computeAngles(const data_t& points)
     for (unsigned i = 0; i < points.size(); i++) {
         dx = points[i][0] - points[pivot_][0];
         dy = points[i][1] - points[pivot_][1];
-        polar_.push_back(-(dx / dy));
+        // bounded pseudo angle, monotone as -(dx / dy) but finite for
+        // points on the same height as pivot
+        if (fabs(dx) + dy < EPS) {
+            polar_.push_back(0);
+        } else {
+            polar_.push_back(-dx / (fabs(dx) + dy));
+        }
     }
 }
 
@@ -188,6 +195,21 @@ unsigned GrahamScan2D::scan(const data_t& inputData, unsigned * ptStack)
     return sPtr;
 }
 
+void GrahamScan2D::emitStack(const data_t& inputData,
+                             const unsigned * ptStack, unsigned stackSize,
+                             Points2D& output)
+{
+    // lower chain goes left from pivot to the smallest point
+    unsigned first = 0;
+    while (first + 1 < stackSize && inputData[ptStack[first + 1]]
+                                    < inputData[ptStack[first]]) {
+        first++;
+    }
+    for (unsigned i = 0; i < stackSize; i++) {
+        emit(output, inputData[ptStack[(first + i) % stackSize]]);
+    }
+}
+
 void GrahamScan2D::sortPoints(const data_t& inputData)
 {
     computeAngles(inputData);
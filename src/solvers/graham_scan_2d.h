@@ -7,6 +7,7 @@
 #include <parallel/settings.h>
 
 #include "solvers/solver_2d.h"
+#include "solvers/small_hull_2d.h"
 #include "lib/structures.h"
 #include "lib/geometry.h"
 
@@ -44,6 +45,10 @@ class GrahamScan2D : public Solver2D
         /** Does linear pass through sorted points and finds hull */
         unsigned scan(const data_t& inputData, unsigned * ptStack);
 
+        /** Emits hull from stack, starting at its smallest point */
+        void emitStack(const data_t& inputData, const unsigned * ptStack,
+                       unsigned stackSize, Points2D& output);
+
         /** Parallel point sorting */
         void sortPointsParallel(const data_t& inputData);
 
@@ -0,0 +1,205 @@
+#include "solvers/hull_analytics_2d.h"
+
+namespace ch
+{
+
+HullAnalytics2D::HullAnalytics2D(const Points2D& hull)
+{
+    // solvers output hull turning right, calipers go the other way
+    const data_t& data = hull.getData();
+    for (int i = data.size() - 1; i >= 0; i--) {
+        pts_.push_back({data[i][0], data[i][1]});
+    }
+}
+
+double HullAnalytics2D::area() const
+{
+    double sum = 0;
+    for (unsigned i = 0; i < pts_.size(); i++) {
+        const point2d_t& a = pts_[i], & b = pts_[next(i)];
+        sum += a.first * b.second - a.second * b.first;
+    }
+    return sum / 2;
+}
+
+double HullAnalytics2D::perimeter() const
+{
+    double sum = 0;
+    if (pts_.size() < 2) {
+        return sum;
+    }
+    for (unsigned i = 0; i < pts_.size(); i++) {
+        sum += dist(pts_[i], pts_[next(i)]);
+    }
+    return sum;
+}
+
+point2d_t HullAnalytics2D::centroid() const
+{
+    unsigned h = pts_.size();
+    if (h == 0) {
+        return {0, 0};
+    }
+
+    // triangles of fan from first vertex, relative to it for precision
+    double ox = pts_[0].first, oy = pts_[0].second,
+           sum = 0, cx = 0, cy = 0;
+    for (unsigned i = 1; i + 1 < h; i++) {
+        double ax = pts_[i].first - ox, ay = pts_[i].second - oy,
+               bx = pts_[i + 1].first - ox, by = pts_[i + 1].second - oy,
+               a = ax * by - ay * bx;
+        sum += a;
+        cx += a * (ax + bx);
+        cy += a * (ay + by);
+    }
+    if (sum > EPS) {
+        return {ox + cx / (3 * sum), oy + cy / (3 * sum)};
+    }
+
+    for (unsigned i = 1; i < h; i++) {
+        cx += pts_[i].first - ox;
+        cy += pts_[i].second - oy;
+    }
+    return {ox + cx / h, oy + cy / h};
+}
+
+double HullAnalytics2D::diameter(point2d_t& a, point2d_t& b) const
+{
+    unsigned h = pts_.size();
+    if (h == 0) {
+        return 0;
+    }
+    a = b = pts_[0];
+    double best = 0;
+
+    // vertex farthest from edge i is antipodal to both its ends
+    unsigned j = next(0);
+    for (unsigned i = 0; i < h; i++) {
+        const point2d_t& p = pts_[i], & q = pts_[next(i)];
+        while (cross(p.first, p.second, q.first, q.second,
+                     pts_[next(j)].first, pts_[next(j)].second)
+               > cross(p.first, p.second, q.first, q.second,
+                       pts_[j].first, pts_[j].second)) {
+            j = next(j);
+        }
+        for (const point2d_t* end : {&p, &q}) {
+            double d = dist(*end, pts_[j]);
+            if (d > best) {
+                best = d;
+                a = *end;
+                b = pts_[j];
+            }
+        }
+    }
+    return best;
+}
+
+double HullAnalytics2D::width(point2d_t& normal) const
+{
+    unsigned h = pts_.size();
+    normal = {0, 1};
+    if (h < 2) {
+        return 0;
+    }
+
+    double best = INFINITY;
+    unsigned j = next(0);
+    for (unsigned i = 0; i < h; i++) {
+        const point2d_t& p = pts_[i], & q = pts_[next(i)];
+        while (cross(p.first, p.second, q.first, q.second,
+                     pts_[next(j)].first, pts_[next(j)].second)
+               > cross(p.first, p.second, q.first, q.second,
+                       pts_[j].first, pts_[j].second)) {
+            j = next(j);
+        }
+        double len = dist(p, q),
+               w = cross(p.first, p.second, q.first, q.second,
+                         pts_[j].first, pts_[j].second) / len;
+        if (w < best) {
+            best = w;
+            // edge normal pointing into hull
+            normal = {-(q.second - p.second) / len,
+                      (q.first - p.first) / len};
+        }
+    }
+    return best;
+}
+
+HullAnalytics2D::Rectangle HullAnalytics2D::minAreaRectangle() const
+{
+    return minRectangle(true);
+}
+
+HullAnalytics2D::Rectangle HullAnalytics2D::minPerimeterRectangle() const
+{
+    return minRectangle(false);
+}
+
+HullAnalytics2D::Rectangle HullAnalytics2D::minRectangle(bool byArea) const
+{
+    Rectangle best;
+    unsigned h = pts_.size();
+    if (h < 2) {
+        point2d_t p = h ? pts_[0] : point2d_t(0, 0);
+        best = {{p, p, p, p}, 0, 0};
+        return best;
+    }
+
+    double bestVal = INFINITY;
+    // extremes along edge direction u, its normal v and against u
+    unsigned right = next(0), top = 0, left = 0;
+    for (unsigned i = 0; i < h; i++) {
+        const point2d_t& p = pts_[i], & q = pts_[next(i)];
+        double len = dist(p, q),
+               ux = (q.first - p.first) / len,
+               uy = (q.second - p.second) / len,
+               vx = -uy, vy = ux;
+        auto du = [&](unsigned k) {
+            return pts_[k].first * ux + pts_[k].second * uy;
+        };
+        auto dv = [&](unsigned k) {
+            return pts_[k].first * vx + pts_[k].second * vy;
+        };
+
+        while (du(next(right)) > du(right)) {
+            right = next(right);
+        }
+        if (i == 0) {
+            top = right;
+        }
+        while (dv(next(top)) > dv(top)) {
+            top = next(top);
+        }
+        if (i == 0) {
+            left = top;
+        }
+        while (du(next(left)) < du(left)) {
+            left = next(left);
+        }
+
+        double lo = du(left), hi = du(right), bottom = dv(i), up = dv(top),
+               val = byArea ? (hi - lo) * (up - bottom)
+                            : (hi - lo) + (up - bottom);
+        if (val < bestVal) {
+            bestVal = val;
+            // corners from coordinates along u and v, turning right
+            auto corner = [&](double a, double b) {
+                return point2d_t(a * ux + b * vx, a * uy + b * vy);
+            };
+            best.corners[0] = corner(lo, bottom);
+            best.corners[1] = corner(lo, up);
+            best.corners[2] = corner(hi, up);
+            best.corners[3] = corner(hi, bottom);
+            best.area = (hi - lo) * (up - bottom);
+            best.perimeter = 2 * ((hi - lo) + (up - bottom));
+        }
+    }
+    return best;
+}
+
+unsigned HullAnalytics2D::next(unsigned i) const
+{
+    return i + 1 == pts_.size() ? 0 : i + 1;
+}
+
+}
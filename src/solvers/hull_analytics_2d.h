@@ -0,0 +1,83 @@
+#pragma once
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "lib/structures.h"
+#include "lib/geometry.h"
+
+namespace ch
+{
+
+/**
+ * Measures of computed hull.
+ *
+ * Extents are found by rotating calipers: for every edge, the vertices
+ * extreme in its direction and in its normal only move forward along hull,
+ * so each measure takes one O(h) pass. Hulls of one or two vertices are
+ * taken as point or segment.
+ */
+class HullAnalytics2D
+{
+    public:
+        /** Rectangle given by corners in output order, with its measures */
+        struct Rectangle {
+            point2d_t corners[4];
+            double area, perimeter;
+        };
+
+        /**
+         * Constructor.
+         *
+         * @param hull hull in the order produced by solvers, without
+         *             collinear points
+         */
+        HullAnalytics2D(const Points2D& hull);
+
+        double area() const;
+        double perimeter() const;
+
+        /** Centroid of hull area, of vertices if hull has no area */
+        point2d_t centroid() const;
+
+        /**
+         * Finds farthest pair of hull vertices
+         *
+         * @param a output, first vertex of pair
+         * @param b output, second vertex of pair
+         * @return distance of the pair
+         */
+        double diameter(point2d_t& a, point2d_t& b) const;
+
+        /**
+         * Finds smallest distance of two parallel lines enclosing hull
+         *
+         * @param normal output, unit normal of the lines
+         * @return width of hull
+         */
+        double width(point2d_t& normal) const;
+
+        /** Enclosing rectangle of smallest area, one side lies on hull edge */
+        Rectangle minAreaRectangle() const;
+
+        /** Enclosing rectangle of smallest perimeter */
+        Rectangle minPerimeterRectangle() const;
+
+    private:
+        /**
+         * Finds enclosing rectangle with side on hull edge minimizing
+         * measure, all four calipers move around hull together
+         *
+         * @param byArea minimize area if true, perimeter otherwise
+         */
+        Rectangle minRectangle(bool byArea) const;
+
+        /** Index of vertex after i, around hull */
+        unsigned next(unsigned i) const;
+
+        /** Hull vertices, counter clockwise */
+        std::vector<point2d_t> pts_;
+};
+
+}
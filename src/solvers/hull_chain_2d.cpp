@@ -0,0 +1,106 @@
+#include "solvers/hull_chain_2d.h"
+
+namespace ch
+{
+
+HullChain2D::HullChain2D()
+{
+    mode_ = FULL;
+    fromX_ = toX_ = fromY_ = toY_ = 0;
+}
+
+HullChain2D::HullChain2D(Mode mode)
+{
+    mode_ = mode;
+    fromY_ = toY_ = 0;
+    fromX_ = mode == LOWER ? 1 : -1;
+    toX_ = -fromX_;
+}
+
+HullChain2D::HullChain2D(double fromX, double fromY, double toX, double toY)
+{
+    mode_ = RANGE;
+    fromX_ = fromX;
+    fromY_ = fromY;
+    toX_ = toX;
+    toY_ = toY;
+}
+
+void HullChain2D::ends(const data_t& input, std::vector<unsigned>& ends) const
+{
+    ends.clear();
+    // clockwise sweep in [0, 2 pi), longer one is split in half
+    double from = atan2(fromY_, fromX_), to = atan2(toY_, toX_),
+           sweep = from - to;
+    if (sweep < 0) {
+        sweep += 2 * M_PI;
+    }
+    ends.push_back(extreme(input, fromX_, fromY_, false));
+    if (sweep > M_PI) {
+        double mid = from - sweep / 2;
+        ends.push_back(extreme(input, cos(mid), sin(mid), false));
+    }
+    ends.push_back(extreme(input, toX_, toY_, true));
+}
+
+Points2D& HullChain2D::cut(const Points2D& hull, Points2D& output) const
+{
+    const data_t& data = hull.getData();
+    unsigned h = data.size();
+    if (h == 0) {
+        return output;
+    }
+    if (mode_ == FULL) {
+        for (auto& pt : data) {
+            output.add(pt);
+        }
+        return output;
+    }
+
+    std::vector<unsigned> pieces;
+    ends(data, pieces);
+    output.add(data[pieces[0]]);
+    for (unsigned k = 1; k < pieces.size(); k++) {
+        for (unsigned i = pieces[k - 1]; i != pieces[k]; ) {
+            i = (i + 1) % h;
+            if (!closes(pieces, k) || i != pieces[k]) {
+                output.add(data[i]);
+            }
+        }
+    }
+    return output;
+}
+
+unsigned HullChain2D::extreme(const data_t& input, double dx, double dy,
+                              bool last)
+{
+    // tie of largest dot product is taken against fixed bound, so that
+    // it cannot drift inside of an edge, rounding of dot products grows
+    // with coordinates
+    double maxDot = -INFINITY, size = 1;
+    for (auto& pt : input) {
+        maxDot = std::max(maxDot, pt[0] * dx + pt[1] * dy);
+        size = std::max(size, std::max(fabs(pt[0]), fabs(pt[1])));
+    }
+    double bound = maxDot
+                   - EPS * size * std::max(1.0, sqrt(dx * dx + dy * dy));
+
+    // clockwise edge of tied points goes along direction turned right,
+    // its ends are hull vertices
+    double ux = dy, uy = -dx, bestAlong = 0;
+    unsigned best = input.size();
+    for (unsigned i = 0; i < input.size(); i++) {
+        if (input[i][0] * dx + input[i][1] * dy < bound) {
+            continue;
+        }
+        double along = input[i][0] * ux + input[i][1] * uy;
+        if (best == input.size()
+            || (last ? along > bestAlong : along < bestAlong)) {
+            best = i;
+            bestAlong = along;
+        }
+    }
+    return best;
+}
+
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <vector>
+#include <cmath>
+
+#include "lib/structures.h"
+#include "lib/geometry.h"
+
+namespace ch
+{
+
+/**
+ * Part of hull found by solvers supporting partial hulls.
+ *
+ * Chain holds hull vertices extreme in some direction of clockwise sweep
+ * from one direction to another, in the order used by solvers. Upper chain
+ * sweeps from left to right, lower one from right to left, both keep
+ * vertical edges at their ends. Solvers find chain by pieces of at most
+ * half turn, vertices of piece lie beyond line through its ends, so other
+ * points are skipped.
+ */
+class HullChain2D
+{
+    public:
+        /** Kind of chain */
+        enum Mode {FULL, UPPER, LOWER, RANGE};
+
+        /** Whole hull */
+        HullChain2D();
+
+        /** Whole hull, upper or lower chain */
+        HullChain2D(Mode mode);
+
+        /**
+         * Chain between directions, equal directions give single vertex
+         *
+         * @param fromX x coordinate of direction sweep starts at
+         * @param fromY y coordinate of direction sweep starts at
+         * @param toX x coordinate of direction sweep ends at
+         * @param toY y coordinate of direction sweep ends at
+         */
+        HullChain2D(double fromX, double fromY, double toX, double toY);
+
+        inline Mode getMode() const { return mode_; }
+
+        /**
+         * Finds ends of chain pieces, piece k goes from ends[k] to
+         * ends[k + 1], ends may repeat, used for modes other than FULL
+         *
+         * @param input points, at least one
+         * @param ends output, indexes of input points
+         */
+        void ends(const data_t& input, std::vector<unsigned>& ends) const;
+
+        /**
+         * Whether piece ending at ends[k] closes whole hull, its end is
+         * then the first vertex and is not output again
+         */
+        static inline bool closes(const std::vector<unsigned>& ends,
+                                  unsigned k)
+        {
+            return ends.size() > 2 && k + 1 == ends.size()
+                   && ends[k] == ends[0];
+        }
+
+        /**
+         * Writes chain of whole hull
+         *
+         * @param hull hull in the order produced by solvers
+         * @param output chain
+         * @return Same as output param, reference to result
+         */
+        Points2D& cut(const Points2D& hull, Points2D& output) const;
+
+    private:
+        /**
+         * Point extreme in direction, of tied ones the first or the last
+         * one clockwise
+         */
+        static unsigned extreme(const data_t& input, double dx, double dy,
+                                bool last);
+
+        Mode mode_;
+
+        /** Directions sweep starts and ends at */
+        double fromX_, fromY_, toX_, toY_;
+};
+
+}
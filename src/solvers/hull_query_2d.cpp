@@ -0,0 +1,140 @@
+#include "solvers/hull_query_2d.h"
+
+namespace ch
+{
+
+/** Location of point in triangle lo of fan, as HullQuery2D::Location */
+static inline int fanLocation(const double* hx, const double* hy, int k,
+                              int lo, double tol, double x, double y)
+{
+    double first = cross(hx[0], hy[0], hx[1], hy[1], x, y),
+           last = cross(hx[0], hy[0], hx[k - 1], hy[k - 1], x, y),
+           edge = cross(hx[lo], hy[lo], hx[lo + 1], hy[lo + 1], x, y);
+    int out = (first > tol) | (last < -tol) | (edge > tol),
+        bound = (first >= -tol) | (last <= tol) | (edge >= -tol);
+    return out ? HullQuery2D::OUTSIDE
+               : bound ? HullQuery2D::BOUNDARY : HullQuery2D::INSIDE;
+}
+
+HullQuery2D::HullQuery2D()
+{
+    levels_ = 0;
+    tolerance_ = EPS;
+}
+
+HullQuery2D::HullQuery2D(const Points2D& hull)
+{
+    for (auto& pt : hull.getData()) {
+        hullX_.push_back(pt[0]);
+        hullY_.push_back(pt[1]);
+    }
+    // fan has k - 2 triangles, search moves over 1..k - 2
+    levels_ = 0;
+    while (hullX_.size() >= 3 && (1U << levels_) < hullX_.size() - 2) {
+        levels_++;
+    }
+    // cross products carry rounding error relative to squared coordinates
+    double size = 1;
+    for (unsigned i = 0; i < hullX_.size(); i++) {
+        size = std::max(size, std::max(fabs(hullX_[i]), fabs(hullY_[i])));
+    }
+    tolerance_ = EPS * size * size;
+}
+
+HullQuery2D::Location HullQuery2D::locate(double x, double y) const
+{
+    if (hullX_.size() < 3) {
+        return locateSmall(x, y);
+    }
+    return locateFan(x, y);
+}
+
+void HullQuery2D::classify(const Points2D& points,
+                           std::vector<Location>& results, int thr) const
+{
+    const data_t& data = points.getData();
+    unsigned n = data.size(), k = hullX_.size(),
+             blocks = (n + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    results.resize(n);
+    if (k < 3) {
+        for (unsigned i = 0; i < n; i++) {
+            results[i] = locateSmall(data[i][0], data[i][1]);
+        }
+        return;
+    }
+
+    if ((unsigned) thr > MAX_NUM_THREADS) {
+        thr = MAX_NUM_THREADS;
+    }
+    if (thr < 1) {
+        thr = 1;
+    }
+    const double* hx = hullX_.data(), * hy = hullY_.data();
+    int levels = levels_;
+    double tol = tolerance_;
+#pragma omp parallel for num_threads(thr) default(shared) schedule(static)
+    for (int b = 0; b < (int) blocks; b++) {
+        unsigned from = b * BLOCK_SIZE,
+                 size = std::min(BLOCK_SIZE, n - from);
+        // search runs one step for whole block at a time, loops over
+        // block have no branches and are vectorized
+        double xs[BLOCK_SIZE], ys[BLOCK_SIZE];
+        int los[BLOCK_SIZE], locs[BLOCK_SIZE];
+        for (unsigned i = 0; i < size; i++) {
+            xs[i] = data[from + i][0];
+            ys[i] = data[from + i][1];
+            los[i] = 1;
+        }
+        for (int l = levels - 1; l >= 0; l--) {
+#pragma omp simd
+            for (int i = 0; i < (int) size; i++) {
+                los[i] = fanStep(hx, hy, k, los[i], 1 << l, xs[i], ys[i]);
+            }
+        }
+#pragma omp simd
+        for (int i = 0; i < (int) size; i++) {
+            locs[i] = fanLocation(hx, hy, k, los[i], tol, xs[i], ys[i]);
+        }
+        for (unsigned i = 0; i < size; i++) {
+            results[from + i] = (Location) locs[i];
+        }
+    }
+}
+
+unsigned HullQuery2D::getSize() const
+{
+    return hullX_.size();
+}
+
+HullQuery2D::Location HullQuery2D::locateFan(double x, double y) const
+{
+    const double* hx = hullX_.data(), * hy = hullY_.data();
+    int k = hullX_.size();
+    return (Location) fanLocation(hx, hy, k, fanTriangle(hx, hy, k, x, y),
+                                  tolerance_, x, y);
+}
+
+HullQuery2D::Location HullQuery2D::locateSmall(double x, double y) const
+{
+    unsigned k = hullX_.size();
+    if (k == 0) {
+        return OUTSIDE;
+    }
+    if (k == 1) {
+        return fabs(hullX_[0] - x) <= EPS * std::max(1.0, fabs(x))
+               && fabs(hullY_[0] - y) <= EPS * std::max(1.0, fabs(y))
+               ? BOUNDARY : OUTSIDE;
+    }
+
+    // segment, point has to lie on its line between both ends
+    double ex = hullX_[1] - hullX_[0], ey = hullY_[1] - hullY_[0],
+           s = (x - hullX_[0]) * ex + (y - hullY_[0]) * ey;
+    if (fabs(cross(hullX_[0], hullY_[0], hullX_[1], hullY_[1], x, y))
+            <= tolerance_
+        && s >= -tolerance_ && s <= ex * ex + ey * ey + tolerance_) {
+        return BOUNDARY;
+    }
+    return OUTSIDE;
+}
+
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <omp.h>
+
+#include "lib/structures.h"
+#include "lib/geometry.h"
+
+namespace ch
+{
+
+/**
+ * Point location against computed hull.
+ *
+ * Hull is split to fan of triangles from its first vertex, point is located
+ * by binary search over the fan and one test against the far edge, so each
+ * query runs in O(log h). Batched queries run the search with fixed number
+ * of steps and no branches, points of one block are located together in
+ * vector registers and blocks are spread over threads.
+ */
+class HullQuery2D
+{
+    public:
+        /**
+         * Result of location, boundary includes vertices and points closer
+         * to it than rounding error of coordinates
+         */
+        enum Location {OUTSIDE, BOUNDARY, INSIDE};
+
+        /** Query over empty hull, every point lies outside */
+        HullQuery2D();
+
+        /**
+         * Constructor.
+         *
+         * @param hull hull in the order produced by solvers, without
+         *             collinear points
+         */
+        HullQuery2D(const Points2D& hull);
+
+        /** Locates one point */
+        Location locate(double x, double y) const;
+
+        /**
+         * Locates all points
+         *
+         * @param points points to locate
+         * @param results location of every point, resized to their count
+         * @param thr number of threads
+         */
+        void classify(const Points2D& points, std::vector<Location>& results,
+                      int thr) const;
+
+        /** Number of hull vertices */
+        unsigned getSize() const;
+
+    private:
+        /** Locates point by branchless search, hull has at least 3 vertices */
+        Location locateFan(double x, double y) const;
+
+        /** Locates point against hull with at most 2 vertices */
+        Location locateSmall(double x, double y) const;
+
+        /** Number of points located together */
+        static const unsigned BLOCK_SIZE = 1024;
+
+        /** Hull vertices, in output order */
+        std::vector<double> hullX_, hullY_;
+
+        /** Number of binary search steps over fan */
+        int levels_;
+
+        /** Bound of cross product of point lying on boundary */
+        double tolerance_;
+};
+
+}
@@ -0,0 +1,44 @@
+#include "solvers/hull_stats_2d.h"
+
+namespace ch
+{
+
+HullStatsAccumulator::HullStatsAccumulator()
+{
+    reset();
+}
+
+void HullStatsAccumulator::reset()
+{
+    count_ = 0;
+    ox_ = oy_ = lx_ = ly_ = 0;
+    area2_ = cx_ = cy_ = sx_ = sy_ = chain_ = 0;
+    minX_ = minY_ = maxX_ = maxY_ = 0;
+}
+
+unsigned HullStatsAccumulator::getCount() const
+{
+    return count_;
+}
+
+HullStats HullStatsAccumulator::result() const
+{
+    HullStats stats;
+    stats.area = fabs(area2_) / 2;
+    stats.perimeter = chain_ + sqrt((lx_ - ox_) * (lx_ - ox_)
+                                    + (ly_ - oy_) * (ly_ - oy_));
+    stats.min = {minX_, minY_};
+    stats.max = {maxX_, maxY_};
+
+    // signs of moments and area cancel for both orientations
+    if (fabs(area2_) > EPS) {
+        stats.centroid = {ox_ + cx_ / (3 * area2_), oy_ + cy_ / (3 * area2_)};
+    } else if (count_ > 0) {
+        stats.centroid = {ox_ + sx_ / count_, oy_ + sy_ / count_};
+    } else {
+        stats.centroid = {0, 0};
+    }
+    return stats;
+}
+
+}
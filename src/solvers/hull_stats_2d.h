@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cmath>
+#include <algorithm>
+
+#include "lib/structures.h"
+#include "lib/geometry.h"
+
+namespace ch
+{
+
+/** Measures of hull, hull of one or two vertices is point or segment */
+struct HullStats {
+    double area, perimeter;
+
+    /** Centroid of hull area, of vertices if hull has no area */
+    point2d_t centroid;
+
+    /** Corners of bounding box */
+    point2d_t min, max;
+};
+
+/**
+ * Accumulates measures of hull from its vertices in hull order.
+ *
+ * Area and centroid are summed over fan of triangles from the first
+ * vertex, relative to it for precision, so closing edge adds nothing to
+ * them and every vertex is visited once.
+ */
+class HullStatsAccumulator
+{
+    public:
+        HullStatsAccumulator();
+
+        /** Forgets all vertices */
+        void reset();
+
+        /** Adds next vertex of hull */
+        inline void add(double x, double y)
+        {
+            if (count_ == 0) {
+                ox_ = minX_ = maxX_ = x;
+                oy_ = minY_ = maxY_ = y;
+            } else {
+                double ax = lx_ - ox_, ay = ly_ - oy_,
+                       bx = x - ox_, by = y - oy_,
+                       a = ax * by - ay * bx;
+                area2_ += a;
+                cx_ += a * (ax + bx);
+                cy_ += a * (ay + by);
+                sx_ += bx;
+                sy_ += by;
+                chain_ += sqrt((x - lx_) * (x - lx_) + (y - ly_) * (y - ly_));
+                minX_ = std::min(minX_, x);
+                maxX_ = std::max(maxX_, x);
+                minY_ = std::min(minY_, y);
+                maxY_ = std::max(maxY_, y);
+            }
+            lx_ = x;
+            ly_ = y;
+            count_++;
+        }
+
+        /** Number of vertices added */
+        unsigned getCount() const;
+
+        /** Measures of hull closed from the last vertex to the first */
+        HullStats result() const;
+
+    private:
+        unsigned count_;
+
+        /** First and last vertex */
+        double ox_, oy_, lx_, ly_;
+
+        /** Twice signed area, its moments and sums of vertices, from first */
+        double area2_, cx_, cy_, sx_, sy_;
+
+        /** Length of open chain of added vertices */
+        double chain_;
+
+        double minX_, minY_, maxX_, maxY_;
+};
+
+}
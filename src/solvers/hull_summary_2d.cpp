@@ -0,0 +1,156 @@
+#include "solvers/hull_summary_2d.h"
+
+namespace ch
+{
+
+HullSummary::HullSummary()
+{
+}
+
+HullSummary::HullSummary(const Points2D& hull)
+{
+    const data_t& data = hull.getData();
+    std::vector<point2d_t> pts;
+    for (auto& pt : data) {
+        pts.push_back({pt[0], pt[1]});
+    }
+    std::rotate(pts.begin(), std::min_element(pts.begin(), pts.end()),
+                pts.end());
+    split(pts.data(), pts.size());
+}
+
+HullSummary::HullSummary(const point2d_t* pts, unsigned n)
+{
+    std::vector<point2d_t> hull(2 * n);
+    split(hull.data(), SmallHull2D::hullSorted(pts, n, hull.data()));
+}
+
+HullSummary HullSummary::merge(const HullSummary& a, const HullSummary& b)
+{
+    // all four chains merged to one sorted list, then one chain pass
+    std::vector<point2d_t> up(a.upper_.size() + b.upper_.size()),
+                           low(a.lower_.size() + b.lower_.size()),
+                           pts(up.size() + low.size()), hull(2 * pts.size());
+    std::merge(a.upper_.begin(), a.upper_.end(), b.upper_.begin(),
+               b.upper_.end(), up.begin());
+    std::merge(a.lower_.begin(), a.lower_.end(), b.lower_.begin(),
+               b.lower_.end(), low.begin());
+    std::merge(up.begin(), up.end(), low.begin(), low.end(), pts.begin());
+
+    HullSummary result;
+    result.split(hull.data(),
+                 SmallHull2D::hullSorted(pts.data(), pts.size(), hull.data()));
+    return result;
+}
+
+HullSummary HullSummary::mergeAll(const std::vector<HullSummary>& parts,
+                                  int thr)
+{
+    if (parts.empty()) {
+        return HullSummary();
+    }
+    if ((unsigned) thr > MAX_NUM_THREADS) {
+        thr = MAX_NUM_THREADS;
+    }
+    if (thr < 1) {
+        thr = 1;
+    }
+    omp_set_num_threads(thr);
+
+    // merge neighbouring summaries, one tree level at a time
+    std::vector<HullSummary> level(parts);
+    while (level.size() > 1) {
+        std::vector<HullSummary> merged((level.size() + 1) / 2);
+#pragma omp parallel for default(shared) schedule(dynamic)
+        for (int i = 0; i < (int) merged.size(); i++) {
+            if (2*i + 1 < (int) level.size()) {
+                merged[i] = merge(level[2*i], level[2*i + 1]);
+            } else {
+                merged[i] = level[2*i];
+            }
+        }
+        level.swap(merged);
+    }
+    return level[0];
+}
+
+Points2D& HullSummary::getHull(Points2D& output) const
+{
+    for (auto& pt : upper_) {
+        output.add({pt.first, pt.second});
+    }
+    for (int i = (int) lower_.size() - 2; i > 0; i--) {
+        output.add({lower_[i].first, lower_[i].second});
+    }
+    return output;
+}
+
+unsigned HullSummary::getSize() const
+{
+    return upper_.size() + std::max(2U, (unsigned) lower_.size()) - 2;
+}
+
+void HullSummary::write(std::ostream& os) const
+{
+    uint32_t sizes[2] = {(uint32_t) upper_.size(), (uint32_t) lower_.size()};
+    os.write((const char*) sizes, sizeof(sizes));
+    for (auto chainPts : {&upper_, &lower_}) {
+        for (auto& pt : *chainPts) {
+            double coords[2] = {pt.first, pt.second};
+            os.write((const char*) coords, sizeof(coords));
+        }
+    }
+}
+
+bool HullSummary::read(std::istream& is)
+{
+    upper_.clear();
+    lower_.clear();
+    uint32_t sizes[2];
+    if (!is.read((char*) sizes, sizeof(sizes))
+        || (sizes[0] == 0) != (sizes[1] == 0)) {
+        return false;
+    }
+    // sizes are not trusted, chains grow only by points actually read
+    for (int c = 0; c < 2; c++) {
+        std::vector<point2d_t>& chainPts = c == 0 ? upper_ : lower_;
+        for (uint32_t i = 0; i < sizes[c]; i++) {
+            double coords[2];
+            if (!is.read((char*) coords, sizeof(coords))) {
+                upper_.clear();
+                lower_.clear();
+                return false;
+            }
+            chainPts.push_back({coords[0], coords[1]});
+        }
+    }
+    // both chains go in lexicographic order between common endpoints
+    if (!upper_.empty()
+        && (upper_.front() != lower_.front() || upper_.back() != lower_.back()
+            || !std::is_sorted(upper_.begin(), upper_.end())
+            || !std::is_sorted(lower_.begin(), lower_.end()))) {
+        upper_.clear();
+        lower_.clear();
+        return false;
+    }
+    return true;
+}
+
+void HullSummary::split(const point2d_t* hull, unsigned h)
+{
+    upper_.clear();
+    lower_.clear();
+    if (h == 0) {
+        return;
+    }
+
+    // hull goes from left over top to right, and back over bottom
+    unsigned hi = std::max_element(hull, hull + h) - hull;
+    upper_.assign(hull, hull + hi + 1);
+    lower_.push_back(hull[0]);
+    for (unsigned i = h - 1; i >= hi && i > 0; i--) {
+        lower_.push_back(hull[i]);
+    }
+}
+
+}
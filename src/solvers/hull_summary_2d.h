@@ -0,0 +1,96 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <omp.h>
+
+#include "lib/structures.h"
+#include "lib/geometry.h"
+#include "solvers/small_hull_2d.h"
+
+namespace ch
+{
+
+/**
+ * Mergeable summary of point set, its hull split to upper and lower chain.
+ *
+ * Both chains are sorted lexicographically, so summaries of any point sets
+ * are merged in linear time by merging chains and one monotone chain pass.
+ * Merging is associative, summaries of shards can be reduced in any tree
+ * and sent between processes in binary form.
+ */
+class HullSummary
+{
+    public:
+        /** Summary of empty set */
+        HullSummary();
+
+        /**
+         * Constructor.
+         *
+         * @param hull hull of point set, in the order produced by solvers
+         */
+        HullSummary(const Points2D& hull);
+
+        /**
+         * Summary of lexicographically sorted points, in linear time
+         *
+         * @param pts n sorted points
+         * @param n number of points
+         */
+        HullSummary(const point2d_t* pts, unsigned n);
+
+        /** Summary of union of both sets, in O(a + b) */
+        static HullSummary merge(const HullSummary& a, const HullSummary& b);
+
+        /**
+         * Merges many summaries by parallel tree of pairwise merges
+         *
+         * @param parts summaries to merge
+         * @param thr number of threads
+         * @return summary of union of all sets
+         */
+        static HullSummary mergeAll(const std::vector<HullSummary>& parts,
+                                    int thr);
+
+        /**
+         * Writes hull in the order used by solvers
+         *
+         * @param output hull vertices are added to it
+         * @return Same as output param, reference to result
+         */
+        Points2D& getHull(Points2D& output) const;
+
+        /** Number of hull vertices */
+        unsigned getSize() const;
+
+        /**
+         * Writes summary in binary form, chain sizes as 32 bit integers
+         * followed by coordinates as doubles in native byte order
+         */
+        void write(std::ostream& os) const;
+
+        /**
+         * Reads summary written by write
+         *
+         * @return false if stream ends early or chains are malformed,
+         *         summary is empty then
+         */
+        bool read(std::istream& is);
+
+    private:
+        /**
+         * Splits hull to chains
+         *
+         * @param hull h vertices in the order used by solvers, starting at
+         *             lexicographically smallest one
+         * @param h number of vertices
+         */
+        void split(const point2d_t* hull, unsigned h);
+
+        /** Chains from lexicographically smallest to largest vertex */
+        std::vector<point2d_t> upper_, lower_;
+};
+
+}
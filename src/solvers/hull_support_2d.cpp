@@ -0,0 +1,111 @@
+#include "solvers/hull_support_2d.h"
+
+namespace ch
+{
+
+HullSupport2D::HullSupport2D()
+{
+}
+
+HullSupport2D::HullSupport2D(const Points2D& hull)
+{
+    for (auto& pt : hull.getData()) {
+        pts_.push_back({pt[0], pt[1]});
+    }
+
+    // solvers output hull turning right, edges go the other way
+    unsigned h = pts_.size(), first = 0;
+    for (unsigned i = 0; i < h && h > 1; i++) {
+        unsigned from = (h - i) % h, to = h - i - 1;
+        double dx = pts_[to].first - pts_[from].first,
+               dy = pts_[to].second - pts_[from].second;
+        if (dx == 0 && dy == 0) {
+            continue;
+        }
+        angles_.push_back(atan2(dy, dx));
+        starts_.push_back(from);
+        if (angles_.back() < angles_[first]) {
+            first = angles_.size() - 1;
+        }
+    }
+    std::rotate(angles_.begin(), angles_.begin() + first, angles_.end());
+    std::rotate(starts_.begin(), starts_.begin() + first, starts_.end());
+}
+
+unsigned HullSupport2D::extreme(double dx, double dy) const
+{
+    if (angles_.empty()) {
+        return 0;
+    }
+    return startAt(std::lower_bound(angles_.begin(), angles_.end(),
+                                    target(dx, dy)) - angles_.begin());
+}
+
+double HullSupport2D::support(double dx, double dy) const
+{
+    if (pts_.empty()) {
+        return -INFINITY;
+    }
+    const point2d_t& p = pts_[extreme(dx, dy)];
+    return p.first * dx + p.second * dy;
+}
+
+void HullSupport2D::extremeAll(const Points2D& directions,
+                               std::vector<unsigned>& results, int thr) const
+{
+    const data_t& data = directions.getData();
+    unsigned n = data.size();
+    results.assign(n, 0);
+    if (angles_.empty() || n == 0) {
+        return;
+    }
+
+    std::vector<std::pair<double, unsigned> > order(n);
+    for (unsigned i = 0; i < n; i++) {
+        order[i] = {target(data[i][0], data[i][1]), i};
+    }
+    std::sort(order.begin(), order.end());
+
+    // every thread merges its part, starting edge found by one search
+    if ((unsigned) thr > MAX_NUM_THREADS) {
+        thr = MAX_NUM_THREADS;
+    }
+    if (thr < 1) {
+        thr = 1;
+    }
+    unsigned parts = std::min((unsigned) thr, n),
+             edges = angles_.size();
+#pragma omp parallel for num_threads(thr) default(shared) schedule(static)
+    for (int t = 0; t < (int) parts; t++) {
+        unsigned from = (unsigned long) n * t / parts,
+                 to = (unsigned long) n * (t + 1) / parts,
+                 edge = std::lower_bound(angles_.begin(), angles_.end(),
+                                         order[from].first)
+                        - angles_.begin();
+        for (unsigned i = from; i < to; i++) {
+            while (edge < edges && angles_[edge] < order[i].first) {
+                edge++;
+            }
+            results[order[i].second] = startAt(edge);
+        }
+    }
+}
+
+unsigned HullSupport2D::getSize() const
+{
+    return pts_.size();
+}
+
+double HullSupport2D::target(double dx, double dy) const
+{
+    // edges leaving extreme vertex turn right angle left of direction
+    double a = atan2(dx, -dy);
+    return a < angles_[0] ? a + 2 * M_PI : a;
+}
+
+unsigned HullSupport2D::startAt(unsigned edge) const
+{
+    return starts_[edge == angles_.size() ? 0 : edge];
+}
+
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <omp.h>
+
+#include "lib/structures.h"
+#include "lib/geometry.h"
+
+namespace ch
+{
+
+/**
+ * Extreme vertex (support) queries against computed hull.
+ *
+ * Edge directions of convex hull grow in angle around it, vertex extreme
+ * in direction d is the start of the first edge turned more than right
+ * angle from d, so one query is binary search over edge angles in
+ * O(log h). Batched queries sort directions by angle and answer them all
+ * in one pass merging them with edges, parts of sorted directions are
+ * merged by separate threads.
+ */
+class HullSupport2D
+{
+    public:
+        /** Query over empty hull */
+        HullSupport2D();
+
+        /**
+         * Constructor.
+         *
+         * @param hull hull in the order produced by solvers, without
+         *             collinear points
+         */
+        HullSupport2D(const Points2D& hull);
+
+        /**
+         * Finds vertex extreme in direction
+         *
+         * @param dx x coordinate of direction
+         * @param dy y coordinate of direction
+         * @return index of the vertex in hull, 0 for empty hull
+         */
+        unsigned extreme(double dx, double dy) const;
+
+        /** Largest dot product of direction with point of hull */
+        double support(double dx, double dy) const;
+
+        /**
+         * Finds extreme vertices for all directions
+         *
+         * @param directions directions, as points
+         * @param results index in hull of every extreme vertex, resized to
+         *                number of directions
+         * @param thr number of threads
+         */
+        void extremeAll(const Points2D& directions,
+                        std::vector<unsigned>& results, int thr) const;
+
+        /** Number of hull vertices */
+        unsigned getSize() const;
+
+    private:
+        /**
+         * Angle of edge leaving vertex extreme in direction, moved by full
+         * turn if below the first edge angle
+         */
+        double target(double dx, double dy) const;
+
+        /** Vertex edge starts at, edge past the last one is the first */
+        unsigned startAt(unsigned edge) const;
+
+        /** Hull vertices, in output order */
+        std::vector<point2d_t> pts_;
+
+        /** Edge angles counter clockwise, increasing from the smallest */
+        std::vector<double> angles_;
+
+        /** Index in hull of vertex every edge starts at */
+        std::vector<unsigned> starts_;
+};
+
+}
@@ -18,6 +18,19 @@ JarvisScan2D::JarvisScan2D(Variant v)
 
 Points2D& JarvisScan2D::solve(const Points2D& input, Points2D& output)
 {
+    SolveScope scope(*this, output);
+    if (input.getSize() <= SmallHull2D::TINY_SIZE) {
+        if (chain_.getMode() == HullChain2D::FULL) {
+            return scope.delegated(SmallHull2D::solveTiny(input, output));
+        }
+        Points2D hull;
+        return scope.delegated(
+            chain_.cut(SmallHull2D::solveTiny(input, hull), output));
+    }
+    if (chain_.getMode() != HullChain2D::FULL) {
+        return solveChain(input, output);
+    }
+
     switch (variant_) {
         case POLAR:
             return solvePolar(input, output);
@@ -40,24 +53,19 @@ Points2D& JarvisScan2D::solveCross(const Points2D& input, Points2D& output)
     point_t currPoint;
     const data_t& inputData = input.getData();
 
-    unsigned maxIndex = 0, currIndex, nextIndex;
+    unsigned minIndex = 0, currIndex, nextIndex;
 
-    // find point with max Y (min X in case of tie)
+    // start at lexicographically smallest point, hull goes clockwise
     for (unsigned i = 1; i < inputData.size(); i++) {
-        double dif = inputData[i][1] - inputData[maxIndex][1];
-        if (fabs(dif) <= EPS) {
-            if (inputData[i][0] > inputData[maxIndex][0]) {
-                maxIndex = i;
-            }
-        } else if (dif > EPS) {
-            maxIndex = i;
+        if (inputData[i] < inputData[minIndex]) {
+            minIndex = i;
         }
     }
 
     // find the rest of points
-    currIndex = maxIndex;
+    currIndex = minIndex;
     do {
-        output.add(inputData[currIndex]);
+        emit(output, inputData[currIndex]);
         // avoid setting same point as next
         nextIndex = !currIndex;
 
@@ -87,13 +95,13 @@ Points2D& JarvisScan2D::solveCross(const Points2D& input, Points2D& output)
                          inputData[nextIndex][1])) {
                     nextIndex = i;
                 }
-            } else if (o == 2) {
+            } else if (o == 1) {
                 // point to the left of current hull face
                 nextIndex = i;
             }
         }
         currIndex = nextIndex;
-    } while (currIndex != maxIndex);
+    } while (currIndex != minIndex);
 
     return output;
 }
@@ -108,54 +116,40 @@ Points2D& JarvisScan2D::solvePolar(const Points2D& input, Points2D& output)
     std::vector<double> currPoint;
     const data_t& inputData = input.getData();
 
-    unsigned maxIndex = 0,
+    unsigned minIndex = 0,
              currIndex,
              nextIndex;
 
-    // find point with max Y (min X in case of tie)
+    // start at lexicographically smallest point, facing up
     for (unsigned i = 1; i < inputData.size(); i++) {
-        double dif = inputData[i][1] - inputData[maxIndex][1];
-        if (fabs(dif) <= EPS) {
-            if (inputData[i][0] > inputData[maxIndex][0]) {
-                maxIndex = i;
-            }
-        } else if (dif > EPS) {
-            maxIndex = i;
+        if (inputData[i] < inputData[minIndex]) {
+            minIndex = i;
         }
     }
 
-    // find the rest of points
-    currIndex = maxIndex;
-    double currAngle = 0, nextAngle, minAngle, relAngle, pureAngle, nextPureAngle;
+    // find the rest of points, hull goes clockwise
+    currIndex = minIndex;
+    double currAngle = PI / 2, nextAngle, minAngle, relAngle, pureAngle,
+           nextPureAngle = currAngle;
     do {
         currPoint = inputData[currIndex];
-        output.add(currPoint);
+        emit(output, currPoint);
 
-        // avoid setting same point as next
-        nextIndex = !currIndex;
-        nextPureAngle = polarAngle(inputData[currIndex][0],
-                                   inputData[currIndex][1],
-                                   inputData[nextIndex][0],
-                                   inputData[nextIndex][1]);
-        minAngle = nextPureAngle + 2*PI - currAngle;
-        if (minAngle > 2*PI + EPS) {
-            minAngle -= 2*PI;
-        }
-
-        // check all remaining n - 1 points, find min polar angle
+        // check all other points, find min clockwise turn
+        nextIndex = currIndex;
+        minAngle = 2*PI + 1;
         for (unsigned i = 0; i < inputData.size(); i++) {
-            if (i == currIndex) {
+            if (inputData[i] == currPoint) {
                 continue;
             }
             pureAngle = polarAngle(inputData[currIndex][0],
                                    inputData[currIndex][1],
                                    inputData[i][0],
                                    inputData[i][1]);
-            nextAngle = pureAngle + 2*PI - currAngle;
-            if (nextAngle > 2*PI + EPS) {
-                nextAngle -= 2*PI;
+            nextAngle = currAngle - pureAngle;
+            if (nextAngle < -EPS) {
+                nextAngle += 2*PI;
             }
-            // std::cout << i << ": " << nextAngle << std::endl;
             relAngle = minAngle - nextAngle;
             if (fabs(relAngle) <= EPS) {
                 // exclude collinear points
@@ -180,7 +174,7 @@ Points2D& JarvisScan2D::solvePolar(const Points2D& input, Points2D& output)
         }
         currAngle = nextPureAngle;
         currIndex = nextIndex;
-    } while (currIndex != maxIndex);
+    } while (currIndex != minIndex);
 
     return output;
 }
@@ -276,17 +270,51 @@ Points2D& JarvisScan2D::solvePara(const Points2D& input, Points2D& output)
 
     for (int i = 0; i < 4; i++) {
         for (auto& pt : part[i]) {
-            output.add(pt);
+            emit(output, pt);
         }
     }
 
     if (output.getSize() == 0) {
-        output.add(inputData[0]);
+        emit(output, inputData[0]);
     }
 
     return output;
 }
 
+Points2D& JarvisScan2D::solveChain(const Points2D& input, Points2D& output)
+{
+    const data_t& inputData = input.getData();
+    std::vector<unsigned> ends;
+    chain_.ends(inputData, ends);
+    emit(output, inputData[ends[0]]);
+    for (unsigned k = 1; k < ends.size(); k++) {
+        if (ends[k] == ends[k - 1]) {
+            continue;
+        }
+        const point_t& a = inputData[ends[k - 1]], & b = inputData[ends[k]];
+
+        // piece is wrapped over its ends and points beyond them
+        data_t plane = {a, b}, part;
+        for (auto& pt : inputData) {
+            if (cross(a[0], a[1], b[0], b[1], pt[0], pt[1]) > EPS) {
+                plane.push_back(pt);
+            }
+        }
+        if (variant_ == CROSS || variant_ == POLAR) {
+            scan(plane, part, 0, 1);
+        } else {
+            scanPara(plane, part, 0, 1);
+        }
+        for (unsigned i = 1; i < part.size(); i++) {
+            emit(output, part[i]);
+        }
+        if (!HullChain2D::closes(ends, k)) {
+            emit(output, b);
+        }
+    }
+    return output;
+}
+
 void JarvisScan2D::scan(const data_t& input, data_t& output,
                         unsigned beginIdx, unsigned endIdx)
 {
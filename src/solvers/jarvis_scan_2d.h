@@ -5,6 +5,8 @@
 #include "lib/structures.h"
 #include "lib/geometry.h"
 #include "solvers/solver_2d.h"
+#include "solvers/small_hull_2d.h"
+#include "solvers/hull_chain_2d.h"
 
 namespace ch
 {
@@ -21,17 +23,27 @@ class JarvisScan2D : public Solver2D
         JarvisScan2D(Variant v);
         inline void setVariant(Variant v) { variant_ = v; }
 
+        /** Selects part of hull to find, whole hull by default */
+        inline void setChain(const HullChain2D& chain) { chain_ = chain; }
+
     private:
         Points2D& solveCross(const Points2D& input, Points2D& output);
         Points2D& solvePolar(const Points2D& input, Points2D& output);
         Points2D& solvePara(const Points2D& input, Points2D& output);
 
+        /**
+         * Wraps chain by pieces, each one over points beyond its ends only,
+         * parallel scan is used for parallel variants
+         */
+        Points2D& solveChain(const Points2D& input, Points2D& output);
+
         void scan(const data_t& input, data_t& output,
                   unsigned beginIdx, unsigned endIdx);
         void scanPara(const data_t& input, data_t& output,
                   unsigned beginIdx, unsigned endIdx);
 
         Variant variant_;
+        HullChain2D chain_;
 };
 
 }
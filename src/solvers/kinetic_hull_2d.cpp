@@ -0,0 +1,174 @@
+#include "solvers/kinetic_hull_2d.h"
+
+namespace ch
+{
+
+KineticHull2D::KineticHull2D()
+{
+    name_ = "Kinetic";
+    frameSize_ = 0;
+    repaired_ = false;
+    motionLimit_ = 0.05;
+    variant_ = SEQ;
+}
+
+KineticHull2D::KineticHull2D(Variant v)
+{
+    name_ = "Kinetic";
+    frameSize_ = 0;
+    repaired_ = false;
+    motionLimit_ = 0.05;
+    variant_ = v;
+}
+
+Points2D& KineticHull2D::solve(const Points2D& input, Points2D& output)
+{
+    SolveScope scope(*this, output);
+    const data_t& inputData = input.getData();
+    unsigned n = inputData.size();
+
+    repaired_ = false;
+    if (n == frameSize_ && ids_.size() >= 3) {
+        std::vector<unsigned> seed(ids_);
+        repaired_ = solveFrom(inputData, seed,
+                              ids_.size() + motionLimit_ * n);
+    }
+    if (!repaired_) {
+        R("Kinetic full solve")
+        std::vector<unsigned> seed;
+        extremes(inputData, seed);
+        solveFrom(inputData, seed, n);
+    }
+    frameSize_ = n;
+
+    for (auto id : ids_) {
+        emit(output, inputData[id]);
+    }
+    return output;
+}
+
+const std::vector<unsigned>& KineticHull2D::getHullIds() const
+{
+    return ids_;
+}
+
+bool KineticHull2D::wasRepaired() const
+{
+    return repaired_;
+}
+
+void KineticHull2D::reset()
+{
+    ids_.clear();
+    frameSize_ = 0;
+    repaired_ = false;
+}
+
+bool KineticHull2D::solveFrom(const data_t& input, std::vector<unsigned>& seed,
+                              unsigned limit)
+{
+    int n = input.size();
+    std::vector<unsigned> polygon;
+    chain(input, seed, polygon);
+
+    // degenerate polygon filters nothing
+    std::vector<unsigned> candidates;
+    if (polygon.size() < 3) {
+        if ((unsigned) n > limit) {
+            return false;
+        }
+        candidates.resize(n);
+        for (int i = 0; i < n; i++) {
+            candidates[i] = i;
+        }
+        chain(input, candidates, ids_);
+        return true;
+    }
+
+    hullX_.resize(polygon.size());
+    hullY_.resize(polygon.size());
+    for (unsigned i = 0; i < polygon.size(); i++) {
+        hullX_[i] = input[polygon[i]][0];
+        hullY_[i] = input[polygon[i]][1];
+    }
+
+    // one classification pass, every thread collects its outer points,
+    // polygon vertices lie on its border and are collected as well
+    bool overflow = false;
+#pragma omp parallel default(shared) if(variant_ == PARA)
+    {
+        std::vector<unsigned> outer;
+#pragma omp for schedule(static)
+        for (int i = 0; i < n; i++) {
+            if (!ptInHull(hullX_.data(), hullY_.data(), hullX_.size(),
+                          input[i][0], input[i][1])) {
+                outer.push_back(i);
+            }
+        }
+#pragma omp critical
+        {
+            candidates.insert(candidates.end(), outer.begin(), outer.end());
+            overflow = overflow || candidates.size() > limit;
+        }
+    }
+    R("Kinetic kept " << candidates.size() << " of " << n)
+    if (overflow) {
+        return false;
+    }
+
+    chain(input, candidates, ids_);
+    return true;
+}
+
+void KineticHull2D::extremes(const data_t& input, std::vector<unsigned>& seed)
+{
+    if (input.empty()) {
+        return;
+    }
+
+    // minima and maxima of x, y, x + y and x - y
+    const double dx[4] = {1, 0, 1, 1}, dy[4] = {0, 1, 1, -1};
+    unsigned lo[4] = {0, 0, 0, 0}, hi[4] = {0, 0, 0, 0};
+    double loVal[4], hiVal[4];
+    for (int d = 0; d < 4; d++) {
+        loVal[d] = hiVal[d] = dx[d] * input[0][0] + dy[d] * input[0][1];
+    }
+    for (unsigned i = 1; i < input.size(); i++) {
+        for (int d = 0; d < 4; d++) {
+            double val = dx[d] * input[i][0] + dy[d] * input[i][1];
+            if (val < loVal[d]) {
+                loVal[d] = val;
+                lo[d] = i;
+            }
+            if (val > hiVal[d]) {
+                hiVal[d] = val;
+                hi[d] = i;
+            }
+        }
+    }
+    seed.assign(lo, lo + 4);
+    seed.insert(seed.end(), hi, hi + 4);
+}
+
+void KineticHull2D::chain(const data_t& input, std::vector<unsigned>& ids,
+                          std::vector<unsigned>& hull)
+{
+    std::sort(ids.begin(), ids.end(), [&input](unsigned a, unsigned b) {
+        return input[a][0] < input[b][0]
+            || (input[a][0] == input[b][0] && input[a][1] < input[b][1]);
+    });
+    std::vector<point2d_t> pts(ids.size()), chain(2 * ids.size());
+    for (unsigned i = 0; i < ids.size(); i++) {
+        pts[i] = {input[ids[i]][0], input[ids[i]][1]};
+    }
+    unsigned h = SmallHull2D::hullSorted(pts.data(), pts.size(), chain.data());
+
+    // vertices are found back among sorted points
+    hull.resize(h);
+    for (unsigned i = 0; i < h; i++) {
+        hull[i] = ids[std::lower_bound(pts.begin(), pts.end(), chain[i])
+                      - pts.begin()];
+    }
+}
+
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <omp.h>
+
+#include "lib/structures.h"
+#include "lib/geometry.h"
+#include "solvers/solver_2d.h"
+#include "solvers/small_hull_2d.h"
+
+namespace ch
+{
+
+/**
+ * Solver for sequence of frames of moving points.
+ *
+ * Point i of every frame is the same moving point. Hull vertices of
+ * previous frame, taken at their new positions, span polygon which is
+ * mostly inside of new hull. All points are classified against it in one
+ * pass and hull is repaired from polygon and few points found outside.
+ * When too many points escape the polygon, motion is considered large
+ * and frame is solved from polygon of extremes in eight directions.
+ */
+class KineticHull2D : public Solver2D
+{
+    public:
+        KineticHull2D();
+
+        /**
+         * Finds hull of next frame
+         *
+         * @param input positions of points in this frame, frame of
+         *              different size than previous one is solved fully
+         * @param output hull of input
+         * @return Same as output param, reference to result
+         */
+        Points2D& solve(const Points2D& input, Points2D& output);
+
+        /** Version switcher, parallel version classifies points in parallel */
+        enum Variant {SEQ, PARA};
+        KineticHull2D(Variant v);
+
+        /** Indices of hull vertices of last frame, in output order */
+        const std::vector<unsigned>& getHullIds() const;
+
+        /** Whether last frame was repaired from previous hull */
+        bool wasRepaired() const;
+
+        /** Forgets previous frame */
+        void reset();
+
+    private:
+        /**
+         * Finds hull from seed polygon and points outside of it
+         *
+         * @param input points of frame
+         * @param seed ids of points spanning polygon
+         * @param limit maximal number of points outside of polygon
+         * @return false if more points than limit are outside
+         */
+        bool solveFrom(const data_t& input, std::vector<unsigned>& seed,
+                       unsigned limit);
+
+        /** Finds ids of points extreme in eight directions */
+        void extremes(const data_t& input, std::vector<unsigned>& seed);
+
+        /**
+         * Finds hull of given points by SmallHull2D::hullSorted
+         *
+         * @param ids points to process, sorted in place
+         * @param hull ids of hull vertices, in output order
+         */
+        void chain(const data_t& input, std::vector<unsigned>& ids,
+                   std::vector<unsigned>& hull);
+
+        /** Hull of last frame */
+        std::vector<unsigned> ids_;
+        unsigned frameSize_;
+        bool repaired_;
+
+        /** Cached vertices of seed polygon, in output order */
+        std::vector<double> hullX_, hullY_;
+
+        /** Maximal share of points outside of previous hull to repair it */
+        double motionLimit_;
+
+        Variant variant_;
+};
+
+}
@@ -0,0 +1,289 @@
+#include "solvers/kirkpatrick_seidel_2d.h"
+
+namespace ch
+{
+
+KirkpatrickSeidel2D::KirkpatrickSeidel2D()
+{
+    name_ = "Kirkpatrick-Seidel";
+    variant_ = SEQ;
+    parallelThreshold_ = 10000;
+}
+
+KirkpatrickSeidel2D::KirkpatrickSeidel2D(Variant v)
+{
+    name_ = "Kirkpatrick-Seidel";
+    variant_ = v;
+    parallelThreshold_ = 10000;
+}
+
+Points2D& KirkpatrickSeidel2D::solve(const Points2D& input, Points2D& output)
+{
+    SolveScope scope(*this, output);
+    if (input.getSize() <= SmallHull2D::TINY_SIZE) {
+        return scope.delegated(SmallHull2D::solveTiny(input, output));
+    }
+
+    const data_t& inputData = input.getData();
+    xar_.resize(inputData.size());
+    yar_.resize(inputData.size());
+    negYar_.resize(inputData.size());
+    for (unsigned i = 0; i < inputData.size(); i++) {
+        xar_[i] = inputData[i][0];
+        yar_[i] = inputData[i][1];
+        negYar_[i] = -inputData[i][1];
+    }
+
+    // parallel variant runs loops of bridge search on all threads, running
+    // both hulls in sections too would need nested parallelism and leave
+    // the loops with one thread each
+    std::vector<unsigned> upper, lower;
+    upperHull(yar_, upper);
+    upperHull(negYar_, lower);
+
+    // from the smallest point, which starts lower hull, over upper hull
+    // from left to right and lower one back, skip shared points
+    std::vector<unsigned> hull(1, lower[0]);
+    hull.insert(hull.end(), upper.begin(), upper.end());
+    for (int i = (int) lower.size() - 1; i > 0; i--) {
+        hull.push_back(lower[i]);
+    }
+    unsigned last = 0;
+    for (unsigned i = 0; i < hull.size(); i++) {
+        if (output.getSize() > 0 && dist(xar_[hull[i]], yar_[hull[i]],
+                                         xar_[last], yar_[last]) < EPS) {
+            continue;
+        }
+        if (i == hull.size() - 1 && output.getSize() > 1
+            && dist(xar_[hull[i]], yar_[hull[i]],
+                    xar_[hull[0]], yar_[hull[0]]) < EPS) {
+            continue;
+        }
+        emit(output, inputData[hull[i]]);
+        last = hull[i];
+    }
+
+    return output;
+}
+
+void KirkpatrickSeidel2D::upperHull(const std::vector<double>& yar,
+                                    std::vector<unsigned>& hull)
+{
+    // leftmost and rightmost point, highest in case of tie
+    unsigned minIdx = 0, maxIdx = 0;
+    for (unsigned i = 1; i < xar_.size(); i++) {
+        if (xar_[i] < xar_[minIdx]
+            || (xar_[i] == xar_[minIdx] && yar[i] > yar[minIdx])) {
+            minIdx = i;
+        }
+        if (xar_[i] > xar_[maxIdx]
+            || (xar_[i] == xar_[maxIdx] && yar[i] > yar[maxIdx])) {
+            maxIdx = i;
+        }
+    }
+
+    hull.push_back(minIdx);
+    if (xar_[minIdx] == xar_[maxIdx]) {
+        return;
+    }
+
+    std::vector<unsigned> pts;
+    pts.push_back(minIdx);
+    for (unsigned i = 0; i < xar_.size(); i++) {
+        if (xar_[i] > xar_[minIdx] && xar_[i] < xar_[maxIdx]
+            && cross(xar_[minIdx], yar[minIdx], xar_[maxIdx], yar[maxIdx],
+                     xar_[i], yar[i]) > EPS) {
+            pts.push_back(i);
+        }
+    }
+    pts.push_back(maxIdx);
+
+    connect(minIdx, maxIdx, pts, yar, hull);
+    hull.push_back(maxIdx);
+}
+
+void KirkpatrickSeidel2D::connect(unsigned k, unsigned m,
+                                  std::vector<unsigned>& pts,
+                                  const std::vector<double>& yar,
+                                  std::vector<unsigned>& hull)
+{
+    if (pts.size() <= 2) {
+        return;
+    }
+
+    // lower median of x, only m has the maximal one
+    std::vector<double> xs(pts.size());
+    for (unsigned i = 0; i < pts.size(); i++) {
+        xs[i] = xar_[pts[i]];
+    }
+    std::nth_element(xs.begin(), xs.begin() + (xs.size() - 1) / 2, xs.end());
+    double a = xs[(xs.size() - 1) / 2];
+
+    std::pair<unsigned, unsigned> br = bridge(pts, a, yar);
+    unsigned i = br.first, j = br.second;
+
+    std::vector<unsigned> left, right;
+    left.push_back(k);
+    right.push_back(j);
+    for (auto p : pts) {
+        if (xar_[p] > xar_[k] && xar_[p] < xar_[i]
+            && cross(xar_[k], yar[k], xar_[i], yar[i],
+                     xar_[p], yar[p]) > EPS) {
+            left.push_back(p);
+        } else if (xar_[p] > xar_[j] && xar_[p] < xar_[m]
+            && cross(xar_[j], yar[j], xar_[m], yar[m],
+                     xar_[p], yar[p]) > EPS) {
+            right.push_back(p);
+        }
+    }
+    left.push_back(i);
+    right.push_back(m);
+    pts.clear();
+    pts.shrink_to_fit();
+
+    if (i != k) {
+        connect(k, i, left, yar, hull);
+        hull.push_back(i);
+    }
+    if (j != m) {
+        hull.push_back(j);
+        connect(j, m, right, yar, hull);
+    }
+}
+
+std::pair<unsigned, unsigned> KirkpatrickSeidel2D::bridge(
+        const std::vector<unsigned>& pts, double a,
+        const std::vector<double>& yar)
+{
+    std::vector<unsigned> cand(pts), next;
+    std::vector<double> slopes, vals;
+    std::vector<char> vertical;
+
+    while (cand.size() > 2) {
+        bool para = variant_ == PARA && cand.size() >= parallelThreshold_;
+        int pairs = cand.size() / 2;
+
+        // order pairs by x, compute their slopes
+        slopes.resize(pairs);
+        vertical.resize(pairs);
+#pragma omp parallel for default(shared) schedule(static) if(para)
+        for (int t = 0; t < pairs; t++) {
+            unsigned& p = cand[2*t], & q = cand[2*t + 1];
+            if (xar_[p] > xar_[q]) {
+                std::swap(p, q);
+            }
+            double dx = xar_[q] - xar_[p];
+            vertical[t] = dx < EPS;
+            slopes[t] = vertical[t] ? 0 : (yar[q] - yar[p]) / dx;
+        }
+
+        next.clear();
+        std::vector<double> nonVertical;
+        for (int t = 0; t < pairs; t++) {
+            if (vertical[t]) {
+                // only higher one of vertical pair can be on bridge
+                unsigned p = cand[2*t], q = cand[2*t + 1];
+                next.push_back(yar[p] > yar[q] ? p : q);
+            } else {
+                nonVertical.push_back(slopes[t]);
+            }
+        }
+        if (cand.size() % 2) {
+            next.push_back(cand.back());
+        }
+        if (nonVertical.empty()) {
+            cand.swap(next);
+            continue;
+        }
+
+        // median slope, find points of support line with that slope
+        std::nth_element(nonVertical.begin(),
+                nonVertical.begin() + nonVertical.size() / 2,
+                nonVertical.end());
+        double med = nonVertical[nonVertical.size() / 2];
+
+        vals.resize(cand.size());
+        double maxVal = yar[cand[0]] - med * xar_[cand[0]];
+#pragma omp parallel for default(shared) schedule(static) if(para) \
+        reduction(max: maxVal)
+        for (int t = 0; t < (int) cand.size(); t++) {
+            vals[t] = yar[cand[t]] - med * xar_[cand[t]];
+            maxVal = std::max(maxVal, vals[t]);
+        }
+
+        double tol = EPS * (1 + fabs(maxVal));
+        unsigned pk = cand[0], pm = cand[0];
+        bool fnd = 0;
+        for (unsigned t = 0; t < cand.size(); t++) {
+            if (vals[t] < maxVal - tol) {
+                continue;
+            }
+            if (!fnd || xar_[cand[t]] < xar_[pk]) {
+                pk = cand[t];
+            }
+            if (!fnd || xar_[cand[t]] > xar_[pm]) {
+                pm = cand[t];
+            }
+            fnd = 1;
+        }
+
+        if (xar_[pk] <= a && xar_[pm] > a) {
+            return {pk, pm};
+        }
+
+        // bridge has smaller slope if support points lie left of a,
+        // left points of steeper pairs cannot be on it (and vice versa)
+        bool lower = xar_[pm] <= a;
+        for (int t = 0; t < pairs; t++) {
+            if (vertical[t]) {
+                continue;
+            }
+            unsigned p = cand[2*t], q = cand[2*t + 1];
+            if (lower && slopes[t] >= med) {
+                next.push_back(q);
+            } else if (!lower && slopes[t] <= med) {
+                next.push_back(p);
+            } else {
+                next.push_back(p);
+                next.push_back(q);
+            }
+        }
+
+        if (next.size() >= cand.size()) {
+            R("KS bridge fallback")
+            return bridgeScan(cand, a, yar);
+        }
+        cand.swap(next);
+    }
+
+    return bridgeScan(cand, a, yar);
+}
+
+std::pair<unsigned, unsigned> KirkpatrickSeidel2D::bridgeScan(
+        std::vector<unsigned> pts, double a, const std::vector<double>& yar)
+{
+    std::sort(pts.begin(), pts.end(), [&](unsigned p, unsigned q) {
+        return xar_[p] < xar_[q] || (xar_[p] == xar_[q] && yar[p] < yar[q]);
+    });
+
+    std::vector<unsigned> chain;
+    for (auto p : pts) {
+        while (chain.size() >= 2 && !ccw(xar_[chain[chain.size() - 2]],
+                                         yar[chain[chain.size() - 2]],
+                                         xar_[chain.back()],
+                                         yar[chain.back()],
+                                         xar_[p], yar[p])) {
+            chain.pop_back();
+        }
+        chain.push_back(p);
+    }
+
+    for (unsigned t = 0; t + 1 < chain.size(); t++) {
+        if (xar_[chain[t]] <= a && xar_[chain[t + 1]] > a) {
+            return {chain[t], chain[t + 1]};
+        }
+    }
+    return {chain.front(), chain.back()};
+}
+
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <omp.h>
+
+#include "lib/structures.h"
+#include "lib/geometry.h"
+#include "solvers/solver_2d.h"
+#include "solvers/small_hull_2d.h"
+
+namespace ch
+{
+
+/**
+ * Marriage-before-conquest solver by Kirkpatrick and Seidel.
+ *
+ * Upper and lower hull are found separately, each by finding bridge over
+ * median x coordinate in linear time and recursing on both sides. Runs in
+ * O(n log h).
+ */
+class KirkpatrickSeidel2D : public Solver2D
+{
+    public:
+        KirkpatrickSeidel2D();
+
+        Points2D& solve(const Points2D& input, Points2D& output);
+
+        /**
+         * Version switcher, parallel version finds bridges over large sets
+         * by loops on all threads
+         */
+        enum Variant {SEQ, PARA};
+        KirkpatrickSeidel2D(Variant v);
+
+    private:
+        /**
+         * Finds upper hull of cached points, from left to right
+         *
+         * @param yar y coordinates, negated ones give lower hull
+         * @param hull output list of point ids
+         */
+        void upperHull(const std::vector<double>& yar,
+                       std::vector<unsigned>& hull);
+
+        /**
+         * Finds upper hull points between two known hull points
+         *
+         * @param k left hull point
+         * @param m right hull point
+         * @param pts k, m and points between them above line km
+         * @param yar y coordinates
+         * @param hull output list, k and m are not added
+         */
+        void connect(unsigned k, unsigned m, std::vector<unsigned>& pts,
+                     const std::vector<double>& yar,
+                     std::vector<unsigned>& hull);
+
+        /**
+         * Finds upper hull edge crossing vertical line x = a
+         *
+         * Prunes quarter of points each round using median slope of pairs.
+         *
+         * @param pts point ids, some on both sides of a
+         * @param a x coordinate of vertical line
+         * @param yar y coordinates
+         * @return left and right endpoint of bridge
+         */
+        std::pair<unsigned, unsigned> bridge(const std::vector<unsigned>& pts,
+                double a, const std::vector<double>& yar);
+
+        /** Slower bridge search, used when pruning hits precision issues */
+        std::pair<unsigned, unsigned> bridgeScan(std::vector<unsigned> pts,
+                double a, const std::vector<double>& yar);
+
+        /** Cached coordinates of input */
+        std::vector<double> xar_, yar_, negYar_;
+
+        /** Minimal number of points to find bridge in parallel */
+        unsigned parallelThreshold_;
+
+        Variant variant_;
+};
+
+}
@@ -10,6 +10,22 @@ MonotoneChain2D::MonotoneChain2D()
 
 Points2D& MonotoneChain2D::solve(const Points2D& input, Points2D& output)
 {
+    SolveScope scope(*this, output);
+    if (input.getSize() <= SmallHull2D::TINY_SIZE) {
+        if (chain_.getMode() == HullChain2D::FULL) {
+            return scope.delegated(SmallHull2D::solveTiny(input, output));
+        }
+        Points2D hull;
+        return scope.delegated(
+            chain_.cut(SmallHull2D::solveTiny(input, hull), output));
+    }
+    if (chain_.getMode() == HullChain2D::RANGE) {
+        // both scans run for range, it is cut from whole hull
+        Points2D hull;
+        return scope.delegated(
+            chain_.cut(solveParallel(input, hull), output));
+    }
+
     // return solveSequential(input, output);
     return solveParallel(input, output);
 }
@@ -33,18 +49,15 @@ Points2D& MonotoneChain2D::solveSequential(const Points2D& input,
     unsigned * lower = new unsigned[input.getSize()],
              * upper = new unsigned[input.getSize()];
 
-    unsigned lowerSize = scanLower(inputData, lower);
-    unsigned upperSize = scanUpper(inputData, upper);
-
-    // do not include last points to avoid duplicates
-    for (unsigned i = 0; i < lowerSize - 1; i++) {
-        output.add(inputData[lower[i]]);
+    unsigned lowerSize = 0, upperSize = 0;
+    if (chain_.getMode() != HullChain2D::UPPER) {
+        lowerSize = scanLower(inputData, lower);
     }
-    delete[] lower;
-
-    for (unsigned i = 0; i < upperSize - 1; i++) {
-        output.add(inputData[upper[i]]);
+    if (chain_.getMode() != HullChain2D::LOWER) {
+        upperSize = scanUpper(inputData, upper);
     }
+    emitChains(inputData, lower, lowerSize, upper, upperSize, output);
+    delete[] lower;
     delete[] upper;
 
     return output;
@@ -72,31 +85,28 @@ Points2D& MonotoneChain2D::solveParallel(const Points2D& input,
     unsigned * lower = new unsigned[input.getSize()],
              * upper = new unsigned[input.getSize()];
 
-    unsigned lowerSize, upperSize;
+    unsigned lowerSize = 0, upperSize = 0;
+    if (chain_.getMode() == HullChain2D::UPPER) {
+        upperSize = scanUpper(inputData, upper);
+    } else if (chain_.getMode() == HullChain2D::LOWER) {
+        lowerSize = scanLower(inputData, lower);
+    } else {
 #pragma omp parallel
-    {
-#pragma omp sections
         {
+#pragma omp sections
+            {
 #pragma omp section
-            lowerSize = scanLower(inputData, lower);
+                lowerSize = scanLower(inputData, lower);
 #pragma omp section
-            upperSize = scanUpper(inputData, upper);
+                upperSize = scanUpper(inputData, upper);
+            }
         }
     }
-
-    // do not include last points to avoid duplicates
-    for (unsigned i = 0; i < lowerSize - 1; i++) {
-        output.add(inputData[lower[i]]);
-    }
+    emitChains(inputData, lower, lowerSize, upper, upperSize, output);
     delete[] lower;
-
-    for (unsigned i = 0; i < upperSize - 1; i++) {
-        output.add(inputData[upper[i]]);
-    }
     delete[] upper;
 
     return output;
-    return output;
 }
 
 unsigned MonotoneChain2D::scanLower(const data_t& input, unsigned* lower)
@@ -137,6 +147,51 @@ unsigned MonotoneChain2D::scanUpper(const data_t& input, unsigned* upper)
     return sSize;
 }
 
+void MonotoneChain2D::emitChains(const data_t& input, const unsigned* lower,
+                                 unsigned lowerSize, const unsigned* upper,
+                                 unsigned upperSize, Points2D& output)
+{
+    // points sorted by x descending, ties by y descending
+    unsigned n = input.size(), first = 0, last = n - 1;
+    switch (chain_.getMode()) {
+        case HullChain2D::UPPER:
+            for (unsigned i = 0; i < upperSize; i++) {
+                emit(output, input[upper[i]]);
+            }
+            // vertical edge on the right belongs to the upper chain too
+            while (first + 1 < n && fabs(input[order_[first + 1]][0]
+                                         - input[order_[0]][0]) < EPS) {
+                first++;
+            }
+            if (input[order_[first]] != input[upper[upperSize - 1]]) {
+                emit(output, input[order_[first]]);
+            }
+            break;
+        case HullChain2D::LOWER:
+            for (unsigned i = 0; i < lowerSize; i++) {
+                emit(output, input[lower[i]]);
+            }
+            // vertical edge on the left belongs to the lower chain too
+            while (last > 0 && fabs(input[order_[last - 1]][0]
+                                    - input[order_[n - 1]][0]) < EPS) {
+                last--;
+            }
+            if (input[order_[last]] != input[lower[lowerSize - 1]]) {
+                emit(output, input[order_[last]]);
+            }
+            break;
+        default:
+            // upper chain starts at the smallest point, do not include
+            // last points to avoid duplicates
+            for (unsigned i = 0; i < upperSize - 1; i++) {
+                emit(output, input[upper[i]]);
+            }
+            for (unsigned i = 0; i < lowerSize - 1; i++) {
+                emit(output, input[lower[i]]);
+            }
+    }
+}
+
 void MonotoneChain2D::sortPtsDirect(const data_t& input)
 {
     std::sort(order_.begin(), order_.end(), PointCmpDirect(input));
@@ -7,6 +7,8 @@
 #include <parallel/settings.h>
 
 #include "solvers/solver_2d.h"
+#include "solvers/small_hull_2d.h"
+#include "solvers/hull_chain_2d.h"
 #include "lib/structures.h"
 #include "lib/geometry.h"
 
@@ -20,6 +22,13 @@ class MonotoneChain2D : public Solver2D
 
         Points2D& solve(const Points2D& input, Points2D& output);
 
+        /**
+         * Selects part of hull to find, whole hull by default. Upper or
+         * lower chain skips scan of the other one, range is cut from whole
+         * hull.
+         */
+        inline void setChain(const HullChain2D& chain) { chain_ = chain; }
+
     private:
         Points2D& solveSequential(const Points2D& input, Points2D& output);
         Points2D& solveParallel(const Points2D& input, Points2D& output);
@@ -27,12 +36,18 @@ class MonotoneChain2D : public Solver2D
         unsigned scanLower(const data_t& input, unsigned* lower);
         unsigned scanUpper(const data_t& input, unsigned* upper);
 
+        /** Writes scanned chains, as selected by chain_ */
+        void emitChains(const data_t& input, const unsigned* lower,
+                        unsigned lowerSize, const unsigned* upper,
+                        unsigned upperSize, Points2D& output);
+
         void sortPtsDirect(const data_t& input);
         void sortPtsCache(const data_t& input);
         void sortPtsParallel(const data_t& input);
 
         std::vector<unsigned> order_;
         std::vector<double> xar_, yar_;
+        HullChain2D chain_;
 
         struct PointCmpDirect {
             PointCmpDirect(const data_t& d)
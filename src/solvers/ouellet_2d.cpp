@@ -0,0 +1,139 @@
+#include "solvers/ouellet_2d.h"
+
+namespace ch
+{
+
+const int Ouellet2D::SIGN_X[4] = {-1, 1, 1, -1};
+const int Ouellet2D::SIGN_Y[4] = {1, 1, -1, -1};
+const bool Ouellet2D::REVERSED[4] = {1, 0, 1, 0};
+
+Ouellet2D::Ouellet2D()
+{
+    name_ = "Ouellet";
+}
+
+Points2D& Ouellet2D::solve(const Points2D& input, Points2D& output)
+{
+    SolveScope scope(*this, output);
+    if (input.getSize() <= SmallHull2D::TINY_SIZE) {
+        return scope.delegated(SmallHull2D::solveTiny(input, output));
+    }
+
+    const data_t& inputData = input.getData();
+
+    // find extremes of every quadrant, in mirrored coordinates top is
+    // max y (max x in case of tie), right is max x (max y in case of tie)
+    unsigned top[4] = {0, 0, 0, 0}, right[4] = {0, 0, 0, 0};
+    for (unsigned i = 1; i < inputData.size(); i++) {
+        for (int q = 0; q < 4; q++) {
+            double x  = SIGN_X[q] * inputData[i][0],
+                   y  = SIGN_Y[q] * inputData[i][1],
+                   tx = SIGN_X[q] * inputData[top[q]][0],
+                   ty = SIGN_Y[q] * inputData[top[q]][1],
+                   rx = SIGN_X[q] * inputData[right[q]][0],
+                   ry = SIGN_Y[q] * inputData[right[q]][1];
+            if (y > ty || (y == ty && x > tx)) {
+                top[q] = i;
+            }
+            if (x > rx || (x == rx && y > ry)) {
+                right[q] = i;
+            }
+        }
+    }
+
+    std::vector<ChainPt> chains[4];
+    double limX[4], limY[4];
+    for (int q = 0; q < 4; q++) {
+        chains[q].push_back({SIGN_X[q] * inputData[top[q]][0],
+                             SIGN_Y[q] * inputData[top[q]][1], top[q]});
+        if (top[q] != right[q]) {
+            chains[q].push_back({SIGN_X[q] * inputData[right[q]][0],
+                                 SIGN_Y[q] * inputData[right[q]][1],
+                                 right[q]});
+        }
+        limX[q] = chains[q].front().x;
+        limY[q] = chains[q].back().y;
+    }
+
+    // quadrant regions are cut off by extremes, cheap rejection of interior
+    for (unsigned i = 0; i < inputData.size(); i++) {
+        for (int q = 0; q < 4; q++) {
+            double x = SIGN_X[q] * inputData[i][0],
+                   y = SIGN_Y[q] * inputData[i][1];
+            if (x > limX[q] && y > limY[q]) {
+                insert(chains[q], {x, y, i});
+            }
+        }
+    }
+
+    // join chains, skip duplicates on their borders
+    std::vector<unsigned> hull;
+    for (int q = 0; q < 4; q++) {
+        for (unsigned j = 0; j < chains[q].size(); j++) {
+            unsigned idx = REVERSED[q] ? chains[q][chains[q].size() - 1 - j].idx
+                                       : chains[q][j].idx;
+            if (!hull.empty() && dist(inputData[hull.back()][0],
+                                      inputData[hull.back()][1],
+                                      inputData[idx][0],
+                                      inputData[idx][1]) < EPS) {
+                continue;
+            }
+            hull.push_back(idx);
+        }
+    }
+    while (hull.size() > 1 && dist(inputData[hull.back()][0],
+                                   inputData[hull.back()][1],
+                                   inputData[hull.front()][0],
+                                   inputData[hull.front()][1]) < EPS) {
+        hull.pop_back();
+    }
+
+    // vertical left edge ends last chain at the smallest point
+    unsigned first = 0;
+    if (hull.size() > 1 && inputData[hull.back()] < inputData[hull[0]]) {
+        first = hull.size() - 1;
+    }
+    for (unsigned i = 0; i < hull.size(); i++) {
+        emit(output, inputData[hull[(first + i) % hull.size()]]);
+    }
+
+    return output;
+}
+
+void Ouellet2D::insert(std::vector<ChainPt>& chain, const ChainPt& pt)
+{
+    // first point of chain with greater or equal x, never the first one
+    unsigned lo = 1, hi = chain.size() - 1, mid;
+    while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (chain[mid].x < pt.x) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    // inside of chain
+    if (!ccw(chain[lo - 1].x, chain[lo - 1].y, pt.x, pt.y,
+             chain[lo].x, chain[lo].y)) {
+        return;
+    }
+
+    chain.insert(chain.begin() + lo, pt);
+
+    // remove points no longer on chain
+    unsigned pos = lo;
+    while (pos + 2 < chain.size() && !ccw(chain[pos].x, chain[pos].y,
+                                          chain[pos + 1].x, chain[pos + 1].y,
+                                          chain[pos + 2].x, chain[pos + 2].y)) {
+        chain.erase(chain.begin() + pos + 1);
+    }
+    while (pos >= 2 && !ccw(chain[pos - 2].x, chain[pos - 2].y,
+                            chain[pos - 1].x, chain[pos - 1].y,
+                            chain[pos].x, chain[pos].y)) {
+        chain.erase(chain.begin() + pos - 1);
+        pos--;
+    }
+}
+
+}
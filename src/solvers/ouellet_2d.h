@@ -0,0 +1,52 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+#include "lib/structures.h"
+#include "lib/geometry.h"
+#include "solvers/solver_2d.h"
+#include "solvers/small_hull_2d.h"
+
+namespace ch
+{
+
+/**
+ * Quadrant based solver in the style of Ouellet.
+ *
+ * Finds extreme points, then keeps convex chain of each of four quadrants,
+ * points are inserted incrementally using binary search. Interior points
+ * are mostly rejected by two comparisons per quadrant.
+ */
+class Ouellet2D : public Solver2D
+{
+    public:
+        Ouellet2D();
+
+        Points2D& solve(const Points2D& input, Points2D& output);
+
+    private:
+        /** Point of quadrant chain, coordinates mirrored to first quadrant */
+        struct ChainPt {
+            double x, y;
+            unsigned idx;
+        };
+
+        /**
+         * Inserts point into quadrant chain, if it lies outside of it
+         *
+         * Chain is ordered by increasing x, points made redundant by the
+         * insertion are removed.
+         *
+         * @param chain convex chain of quadrant
+         * @param pt mirrored point
+         */
+        void insert(std::vector<ChainPt>& chain, const ChainPt& pt);
+
+        /** Mirroring signs of quadrants, in order of output */
+        static const int SIGN_X[4], SIGN_Y[4];
+        /** Whether chain of quadrant is traversed backwards in output */
+        static const bool REVERSED[4];
+};
+
+}
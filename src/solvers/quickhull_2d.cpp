@@ -3,6 +3,28 @@
 namespace ch
 {
 
+/** Position of point along segment ab, scaled by its length */
+static inline double along(const point_t& a, const point_t& b,
+                           const point_t& p)
+{
+    return (p[0] - a[0]) * (b[0] - a[0]) + (p[1] - a[1]) * (b[1] - a[1]);
+}
+
+/**
+ * Whether point replaces the farthest one from segment, of points equally
+ * far the one farthest along segment is taken so that it is hull vertex
+ */
+static inline bool farther(double dist, double pos, double& maxDist,
+                           double& maxPos, double eps)
+{
+    if (dist > maxDist + eps || (dist >= maxDist - eps && pos > maxPos)) {
+        maxDist = std::max(dist, maxDist);
+        maxPos = pos;
+        return true;
+    }
+    return false;
+}
+
 Quickhull2D::Quickhull2D()
     :globIn_(NULL), globOut_(NULL)
 {
@@ -32,6 +54,19 @@ Quickhull2D::Quickhull2D(Variant v, int threshold)
 
 Points2D& Quickhull2D::solve(const Points2D& input, Points2D& output)
 {
+    SolveScope scope(*this, output);
+    if (input.getSize() <= SmallHull2D::TINY_SIZE) {
+        if (chain_.getMode() == HullChain2D::FULL) {
+            return scope.delegated(SmallHull2D::solveTiny(input, output));
+        }
+        Points2D hull;
+        return scope.delegated(
+            chain_.cut(SmallHull2D::solveTiny(input, hull), output));
+    }
+    if (chain_.getMode() != HullChain2D::FULL) {
+        return solveChain(input, output);
+    }
+
     // temp lower global eps
     // EPS = 1e-6;
 
@@ -77,7 +112,7 @@ void Quickhull2D::recNaive(point_t& a, point_t& b, data_t& plane)
     }
 
     recNaive(a, c, acPlane);
-    globOut_ -> add(c);
+    emit(*globOut_, c);
     recNaive(c, b, cbPlane);
 }
 
@@ -100,9 +135,9 @@ Points2D& Quickhull2D::solveNaive(const Points2D& input, Points2D& output)
     divideToPlanes(inputData, pivotLeft, pivotRight, topPlane, botPlane);
 
     // recursive part
-    output.add(pivotLeft);
+    emit(output, pivotLeft);
     recNaive(pivotLeft, pivotRight, topPlane);
-    output.add(pivotRight);
+    emit(output, pivotRight);
     recNaive(pivotRight, pivotLeft, botPlane);
 
     return output;
@@ -174,7 +209,7 @@ void Quickhull2D::recSplit(point_t& a, point_t& b, point_t& c,
 
 
     recSplit(a, c, acFar, acPlane, upper);
-    globOut_ -> add(c);
+    emit(*globOut_, c);
     recSplit(c, b, cbFar, cbPlane, upper);
 }
 
@@ -185,33 +220,33 @@ void Quickhull2D::recSequential(point_t& a, point_t& b, point_t& c,
         return;
 
     data_t acPlane, cbPlane;
-    double acMax = -1, cbMax = -1;
+    double acMax = -1, cbMax = -1, acPos = -INFINITY, cbPos = -INFINITY;
     point_t acFar, cbFar;
 
     double aco, cbo;
     for (auto& pt : plane) {
         aco = cross(a[0], a[1], c[0], c[1], pt[0], pt[1]);
-        if (aco < -EPS_LOC) {
+        if (aco > EPS_LOC) {
             acPlane.push_back(pt);
-            if (fabs(aco) > acMax) {
+            if (farther(fabs(aco), along(a, c, pt), acMax, acPos,
+                        EPS_LOC)) {
                 acFar = pt;
-                acMax = fabs(aco);
             }
             continue;
         }
 
         cbo = cross(c[0], c[1], b[0], b[1], pt[0], pt[1]);
-        if (cbo < -EPS_LOC) {
+        if (cbo > EPS_LOC) {
             cbPlane.push_back(pt);
-            if (fabs(cbo) > cbMax) {
+            if (farther(fabs(cbo), along(c, b, pt), cbMax, cbPos,
+                        EPS_LOC)) {
                 cbFar = pt;
-                cbMax = fabs(cbo);
             }
         }
     }
 
     recSequential(a, c, acFar, acPlane);
-    globOut_ -> add(c);
+    emit(*globOut_, c);
     recSequential(c, b, cbFar, cbPlane);
 }
 
@@ -232,7 +267,7 @@ Points2D& Quickhull2D::solveSequential(const Points2D& input, Points2D& output)
 
     data_t topPlane, botPlane;
     // future farthest points
-    double topMax = -1, botMax = -1;
+    double topMax = -1, botMax = -1, topPos = -INFINITY, botPos = -INFINITY;
     point_t topFar, botFar;
 
     /*
@@ -249,24 +284,24 @@ Points2D& Quickhull2D::solveSequential(const Points2D& input, Points2D& output)
                          pt[0],         pt[1]);
         if (o < -EPS_LOC) {
             topPlane.push_back(pt);
-            if (fabs(o) > topMax) {
+            if (farther(fabs(o), along(pivotRight, pivotLeft, pt), topMax,
+                        topPos, EPS_LOC)) {
                 topFar = pt;
-                topMax = fabs(o);
             }
         } else if (o > EPS_LOC) {
             botPlane.push_back(pt);
-            if (fabs(o) > botMax) {
+            if (farther(fabs(o), along(pivotLeft, pivotRight, pt), botMax,
+                        botPos, EPS_LOC)) {
                 botFar = pt;
-                botMax = fabs(o);
             }
         }
     }
 
     // recursive part
-    output.add(pivotLeft);
-    recSequential(pivotLeft, pivotRight, topFar, topPlane);
-    output.add(pivotRight);
-    recSequential(pivotRight, pivotLeft, botFar, botPlane);
+    emit(output, pivotLeft);
+    recSequential(pivotLeft, pivotRight, botFar, botPlane);
+    emit(output, pivotRight);
+    recSequential(pivotRight, pivotLeft, topFar, topPlane);
 
     return output;
 }
@@ -278,7 +313,7 @@ void Quickhull2D::recPrecomp(point_t& a, point_t& b, point_t& c,
         return;
 
     data_t acPlane, cbPlane;
-    double acMax = -1, cbMax = -1;
+    double acMax = -1, cbMax = -1, acPos = -INFINITY, cbPos = -INFINITY;
     point_t acFar, cbFar;
 
     double aco, cbo;
@@ -291,27 +326,27 @@ void Quickhull2D::recPrecomp(point_t& a, point_t& b, point_t& c,
            gammaCB = betaCB*b[1] - alphaCB*b[0];
     for (auto& pt : plane) {
         aco = partCross(pt[0], pt[1], alphaAC, betaAC, gammaAC);
-        if (aco < -EPS_LOC) {
+        if (aco > EPS_LOC) {
             acPlane.push_back(pt);
-            if (fabs(aco) > acMax) {
+            if (farther(fabs(aco), along(a, c, pt), acMax, acPos,
+                        EPS_LOC)) {
                 acFar = pt;
-                acMax = fabs(aco);
             }
             continue;
         }
 
         cbo = partCross(pt[0], pt[1], alphaCB, betaCB, gammaCB);
-        if (cbo < -EPS_LOC) {
+        if (cbo > EPS_LOC) {
             cbPlane.push_back(pt);
-            if (fabs(cbo) > cbMax) {
+            if (farther(fabs(cbo), along(c, b, pt), cbMax, cbPos,
+                        EPS_LOC)) {
                 cbFar = pt;
-                cbMax = fabs(cbo);
             }
         }
     }
 
     recPrecomp(a, c, acFar, acPlane);
-    globOut_ -> add(c);
+    emit(*globOut_, c);
     recPrecomp(c, b, cbFar, cbPlane);
 }
 
@@ -332,7 +367,7 @@ Points2D& Quickhull2D::solvePrecomp(const Points2D& input, Points2D& output)
 
     data_t topPlane, botPlane;
     // future farthest points
-    double topMax = -1, botMax = -1;
+    double topMax = -1, botMax = -1, topPos = -INFINITY, botPos = -INFINITY;
     point_t topFar, botFar;
 
     // precompute cross product
@@ -345,24 +380,24 @@ Points2D& Quickhull2D::solvePrecomp(const Points2D& input, Points2D& output)
         double o = partCross(pt[0], pt[1], alpha, beta, gamma);
         if (o < -EPS_LOC) {
             topPlane.push_back(pt);
-            if (fabs(o) > topMax) {
+            if (farther(fabs(o), along(pivotRight, pivotLeft, pt), topMax,
+                        topPos, EPS_LOC)) {
                 topFar = pt;
-                topMax = fabs(o);
             }
         } else if (o > EPS_LOC) {
             botPlane.push_back(pt);
-            if (fabs(o) > botMax) {
+            if (farther(fabs(o), along(pivotLeft, pivotRight, pt), botMax,
+                        botPos, EPS_LOC)) {
                 botFar = pt;
-                botMax = fabs(o);
             }
         }
     }
 
     // recursive part
-    output.add(pivotLeft);
-    recPrecomp(pivotLeft, pivotRight, topFar, topPlane);
-    output.add(pivotRight);
-    recPrecomp(pivotRight, pivotLeft, botFar, botPlane);
+    emit(output, pivotLeft);
+    recPrecomp(pivotLeft, pivotRight, botFar, botPlane);
+    emit(output, pivotRight);
+    recPrecomp(pivotRight, pivotLeft, topFar, topPlane);
 
     return output;
 }
@@ -375,7 +410,7 @@ void Quickhull2D::recForwarded(const point_t& a, const point_t& b, const point_t
     }
 
     std::vector<unsigned> acPlane, cbPlane;
-    double acMax = -1, cbMax = -1;
+    double acMax = -1, cbMax = -1, acPos = -INFINITY, cbPos = -INFINITY;
     unsigned acFar = 0, cbFar = 0;
 
     /*
@@ -402,10 +437,9 @@ void Quickhull2D::recForwarded(const point_t& a, const point_t& b, const point_t
                         (*globIn_)[pt][0], (*globIn_)[pt][1]);
         if (aco > EPS_LOC) {
             acPlane.push_back(pt);
-            double fac = fabs(aco);
-            if (fac > acMax) {
+            if (farther(fabs(aco), along(a, c, (*globIn_)[pt]), acMax, acPos,
+                        EPS_LOC)) {
                 acFar = pt;
-                acMax = fac;
             }
             continue;
         }
@@ -414,16 +448,15 @@ void Quickhull2D::recForwarded(const point_t& a, const point_t& b, const point_t
                         (*globIn_)[pt][0], (*globIn_)[pt][1]);
         if (cbo > EPS_LOC) {
             cbPlane.push_back(pt);
-            double fcb = fabs(cbo);
-            if (fcb > cbMax) {
+            if (farther(fabs(cbo), along(c, b, (*globIn_)[pt]), cbMax, cbPos,
+                        EPS_LOC)) {
                 cbFar = pt;
-                cbMax = fcb;
             }
         }
     }
 
     recForwarded(a, c, (*globIn_)[acFar], acPlane, acPlane.size());
-    globOut_ -> add(c);
+    emit(*globOut_, c);
     recForwarded(c, b, (*globIn_)[cbFar], cbPlane, cbPlane.size());
 }
 
@@ -448,7 +481,7 @@ Points2D& Quickhull2D::solveForwarded(const Points2D& input, Points2D& output)
     botPlane.resize(input.getSize());
     unsigned topPtr = 0, botPtr = 0;
     // future farthest points
-    double topMax = -1, botMax = -1;
+    double topMax = -1, botMax = -1, topPos = -INFINITY, botPos = -INFINITY;
     unsigned topFar = 0, botFar = 0;
 
     /*
@@ -470,25 +503,25 @@ Points2D& Quickhull2D::solveForwarded(const Points2D& input, Points2D& output)
         double oa = fabs(o);
         if (o < -EPS_LOC) {
             topPlane[topPtr++] = i;
-            if (oa > topMax) {
+            if (farther(oa, along(pivotRight, pivotLeft, inputData[i]), topMax,
+                        topPos, EPS_LOC)) {
                 topFar = i;
-                topMax = oa;
             }
         } else if (o > EPS_LOC) {
             botPlane[botPtr++] = i;
-            if (oa > botMax) {
+            if (farther(oa, along(pivotLeft, pivotRight, inputData[i]), botMax,
+                        botPos, EPS_LOC)) {
                 botFar = i;
-                botMax = oa;
             }
         }
     }
 
-    output.add(pivotRight);
-    recForwarded(pivotRight, pivotLeft, inputData[topFar], topPlane,
-                topPtr);
-    output.add(pivotLeft);
+    emit(output, pivotLeft);
     recForwarded(pivotLeft, pivotRight, inputData[botFar], botPlane,
                 botPtr);
+    emit(output, pivotRight);
+    recForwarded(pivotRight, pivotLeft, inputData[topFar], topPlane,
+                topPtr);
 
     return output;
 }
@@ -502,7 +535,7 @@ void Quickhull2D::recParallel(const point_t& a, const point_t& b, const point_t&
     }
 
     std::vector<unsigned> acPlane, cbPlane;
-    double acMax = -1, cbMax = -1;
+    double acMax = -1, cbMax = -1, acPos = -INFINITY, cbPos = -INFINITY;
     unsigned acFar = 0, cbFar = 0;
 
     
@@ -530,10 +563,9 @@ void Quickhull2D::recParallel(const point_t& a, const point_t& b, const point_t&
                         (*globIn_)[pt][0], (*globIn_)[pt][1]);
         if (aco > EPS_LOC) {
             acPlane.push_back(pt);
-            double fac = fabs(aco);
-            if (fac > acMax) {
+            if (farther(fabs(aco), along(a, c, (*globIn_)[pt]), acMax, acPos,
+                        EPS_LOC)) {
                 acFar = pt;
-                acMax = fac;
             }
             continue;
         }
@@ -542,10 +574,9 @@ void Quickhull2D::recParallel(const point_t& a, const point_t& b, const point_t&
                         (*globIn_)[pt][0], (*globIn_)[pt][1]);
         if (cbo > EPS_LOC) {
             cbPlane.push_back(pt);
-            double fcb = fabs(cbo);
-            if (fcb > cbMax) {
+            if (farther(fabs(cbo), along(c, b, (*globIn_)[pt]), cbMax, cbPos,
+                        EPS_LOC)) {
                 cbFar = pt;
-                cbMax = fcb;
             }
         }
     }
@@ -609,7 +640,7 @@ Points2D& Quickhull2D::solveParallel(const Points2D& input, Points2D& output)
     botPlane.resize(input.getSize());
     unsigned topPtr = 0, botPtr = 0;
     // future farthest points
-    double topMax = -1, botMax = -1;
+    double topMax = -1, botMax = -1, topPos = -INFINITY, botPos = -INFINITY;
     unsigned topFar = 0, botFar = 0;
 
     /*
@@ -637,15 +668,15 @@ Points2D& Quickhull2D::solveParallel(const Points2D& input, Points2D& output)
         double oa = fabs(o);
         if (o < -EPS_LOC) {
             topPlane[topPtr++] = i;
-            if (oa > topMax) {
+            if (farther(oa, along(pivotRight, pivotLeft, inputData[i]), topMax,
+                        topPos, EPS_LOC)) {
                 topFar = i;
-                topMax = oa;
             }
         } else if (o > EPS_LOC) {
             botPlane[botPtr++] = i;
-            if (oa > botMax) {
+            if (farther(oa, along(pivotLeft, pivotRight, inputData[i]), botMax,
+                        botPos, EPS_LOC)) {
                 botFar = i;
-                botMax = oa;
             }
         }
     }
@@ -672,13 +703,13 @@ Points2D& Quickhull2D::solveParallel(const Points2D& input, Points2D& output)
         }
     }
 
-    output.add(pivotRight);
-    for (auto pt : topList) {
-        output.add(pt);
-    }
-    output.add(pivotLeft);
+    emit(output, pivotLeft);
     for (auto pt : botList) {
-        output.add(pt);
+        emit(output, pt);
+    }
+    emit(output, pivotRight);
+    for (auto pt : topList) {
+        emit(output, pt);
     }
 
     // EPS_LOC = oldEPS_LOC; // return EPS_LOC back to previous state
@@ -686,6 +717,53 @@ Points2D& Quickhull2D::solveParallel(const Points2D& input, Points2D& output)
     return output;
 }
 
+Points2D& Quickhull2D::solveChain(const Points2D& input, Points2D& output)
+{
+    const data_t& inputData = input.getData();
+    globIn_ = &inputData;
+    globOut_ = &output;
+
+    std::vector<unsigned> ends;
+    chain_.ends(inputData, ends);
+    emit(output, inputData[ends[0]]);
+    for (unsigned k = 1; k < ends.size(); k++) {
+        if (ends[k] == ends[k - 1]) {
+            continue;
+        }
+        const point_t& a = inputData[ends[k - 1]], & b = inputData[ends[k]];
+
+        // single plane beyond piece ends, other points are skipped
+        std::vector<unsigned> plane;
+        double farMax = -1, farPos = -INFINITY;
+        unsigned far = 0;
+        for (unsigned i = 0; i < inputData.size(); i++) {
+            double o = cross(a[0], a[1], b[0], b[1],
+                             inputData[i][0], inputData[i][1]);
+            if (o > EPS_LOC) {
+                plane.push_back(i);
+                if (farther(o, along(a, b, inputData[i]), farMax, farPos,
+                            EPS_LOC)) {
+                    far = i;
+                }
+            }
+        }
+
+        if (variant_ == PARA) {
+            std::list<point_t> onHull;
+            recParallel(a, b, inputData[far], plane, plane.size(), onHull);
+            for (auto& pt : onHull) {
+                emit(output, pt);
+            }
+        } else {
+            recForwarded(a, b, inputData[far], plane, plane.size());
+        }
+        if (!HullChain2D::closes(ends, k)) {
+            emit(output, b);
+        }
+    }
+    return output;
+}
+
 Points2D& Quickhull2D::solveIterative(const Points2D& input, Points2D& output)
 {
     if (input.getSize() <= 2) {
@@ -716,7 +794,7 @@ Points2D& Quickhull2D::solveIterative(const Points2D& input, Points2D& output)
     bases.push_back(botFace);
 
     for (auto base : bases) {
-        output.add(base -> a);
+        emit(output, base -> a);
         std::stack<Face*> faces;
         faces.push(base);
 
@@ -724,7 +802,7 @@ Points2D& Quickhull2D::solveIterative(const Points2D& input, Points2D& output)
             Face * curr = faces.top();
             faces.pop();
             if (curr -> save) {
-                output.add(curr -> a);
+                emit(output, curr -> a);
                 delete curr;
                 continue;
             }
@@ -762,25 +840,14 @@ Points2D& Quickhull2D::solveIterative(const Points2D& input, Points2D& output)
 
 std::pair<point_t, point_t> Quickhull2D::minMaxX(const data_t& points)
 {
-    double delta;
     point_t minX = points[0], maxX = points[0];
     for (unsigned i = 1; i < points.size(); i++) {
-        delta = minX[0] - points[i][0];
-        if (delta > EPS_LOC) {
+        // lexicographic extremes, hull is emitted from the smaller one
+        if (points[i] < minX) {
             minX = points[i];
-        } else if (fabs(delta) < EPS_LOC) {
-            if (minX[1] + EPS_LOC < points[i][1]) {
-                minX = points[i];
-            }
         }
-
-        delta = maxX[0] - points[i][0];
-        if (delta < -EPS_LOC) {
+        if (maxX < points[i]) {
             maxX = points[i];
-        } else if (fabs(delta) < EPS_LOC) {
-            if (maxX[1] - EPS_LOC > points[i][1]) {
-                maxX = points[i];
-            }
         }
     }
 
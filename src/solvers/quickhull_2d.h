@@ -9,6 +9,8 @@
 #include "lib/structures.h"
 #include "lib/geometry.h"
 #include "solvers/solver_2d.h"
+#include "solvers/small_hull_2d.h"
+#include "solvers/hull_chain_2d.h"
 
 namespace ch
 {
@@ -23,6 +25,9 @@ class Quickhull2D : public Solver2D
         Quickhull2D(Variant v);
         Quickhull2D(Variant v, int threshold);
 
+        /** Selects part of hull to find, whole hull by default */
+        inline void setChain(const HullChain2D& chain) { chain_ = chain; }
+
     private:
         void recNaive(point_t& a, point_t& b, data_t& plane);
         Points2D& solveNaive(const Points2D& input, Points2D& output);
@@ -47,6 +52,12 @@ class Quickhull2D : public Solver2D
 
         Points2D& solveIterative(const Points2D& input, Points2D& output);
 
+        /**
+         * Finds chain by pieces, each one recursing over single plane of
+         * points beyond its ends, forwarded or parallel recursion is used
+         */
+        Points2D& solveChain(const Points2D& input, Points2D& output);
+
         std::pair<point_t, point_t> minMaxX(const data_t& points);
         std::pair<point_t, point_t> farthestPoints(const data_t& points);
 
@@ -71,6 +82,7 @@ class Quickhull2D : public Solver2D
         double EPS_LOC;
 
         Variant variant_;
+        HullChain2D chain_;
 };
 
 }
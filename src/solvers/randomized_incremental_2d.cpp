@@ -0,0 +1,190 @@
+#include "solvers/randomized_incremental_2d.h"
+
+namespace ch
+{
+
+RandomizedIncremental2D::RandomizedIncremental2D()
+{
+    name_ = "Randomized Incremental";
+    rng_.seed(1);
+}
+
+RandomizedIncremental2D::RandomizedIncremental2D(unsigned seed)
+{
+    name_ = "Randomized Incremental";
+    rng_.seed(seed);
+}
+
+Points2D& RandomizedIncremental2D::solve(const Points2D& input,
+                                         Points2D& output)
+{
+    SolveScope scope(*this, output);
+    if (input.getSize() <= SmallHull2D::TINY_SIZE) {
+        return scope.delegated(SmallHull2D::solveTiny(input, output));
+    }
+
+    const data_t& inputData = input.getData();
+    unsigned n = inputData.size();
+    xar_.resize(n);
+    yar_.resize(n);
+    for (unsigned i = 0; i < n; i++) {
+        xar_[i] = inputData[i][0];
+        yar_[i] = inputData[i][1];
+    }
+
+    std::vector<unsigned> order(n);
+    for (unsigned i = 0; i < n; i++) {
+        order[i] = i;
+    }
+    std::shuffle(order.begin(), order.end(), rng_);
+
+    if (!init(order)) {
+        // all points on one line, its ends form the hull
+        unsigned lo = 0, hi = 0;
+        for (unsigned i = 1; i < n; i++) {
+            if (xar_[i] < xar_[lo]
+                || (xar_[i] == xar_[lo] && yar_[i] < yar_[lo])) {
+                lo = i;
+            }
+            if (xar_[i] > xar_[hi]
+                || (xar_[i] == xar_[hi] && yar_[i] > yar_[hi])) {
+                hi = i;
+            }
+        }
+        emit(output, inputData[lo]);
+        if (dist(xar_[lo], yar_[lo], xar_[hi], yar_[hi]) > EPS) {
+            emit(output, inputData[hi]);
+        }
+        return output;
+    }
+
+    for (unsigned i = 3; i < n; i++) {
+        insert(order[i]);
+    }
+
+    // output from leftmost vertex
+    unsigned first = start_;
+    for (unsigned v = next_[start_]; v != start_; v = next_[v]) {
+        if (xar_[v] < xar_[first]
+            || (xar_[v] == xar_[first] && yar_[v] < yar_[first])) {
+            first = v;
+        }
+    }
+    unsigned v = first;
+    do {
+        emit(output, inputData[v]);
+        v = next_[v];
+    } while (v != first);
+
+    return output;
+}
+
+bool RandomizedIncremental2D::init(std::vector<unsigned>& order)
+{
+    unsigned n = order.size();
+
+    // first point distinct from order[0], then first one off their line
+    unsigned j = 1;
+    while (j < n && dist(xar_[order[0]], yar_[order[0]],
+                         xar_[order[j]], yar_[order[j]]) < EPS) {
+        j++;
+    }
+    if (j == n) {
+        return false;
+    }
+    std::swap(order[1], order[j]);
+
+    unsigned a = order[0], b = order[1], k = 2;
+    while (k < n && fabs(cross(xar_[a], yar_[a], xar_[b], yar_[b],
+                               xar_[order[k]], yar_[order[k]])) <= EPS) {
+        k++;
+    }
+    if (k == n) {
+        return false;
+    }
+    std::swap(order[2], order[k]);
+    unsigned c = order[2];
+
+    // triangle in output order, turning right
+    if (cross(xar_[a], yar_[a], xar_[b], yar_[b], xar_[c], yar_[c]) > 0) {
+        std::swap(b, c);
+    }
+    next_.assign(n, 0);
+    prev_.assign(n, 0);
+    next_[a] = b; next_[b] = c; next_[c] = a;
+    prev_[a] = c; prev_[b] = a; prev_[c] = b;
+    start_ = a;
+
+    conf_.assign(n, -1);
+    edgeConf_.assign(n, std::vector<unsigned>());
+    for (unsigned i = 3; i < n; i++) {
+        unsigned p = order[i];
+        for (unsigned v : {a, b, c}) {
+            if (sees(v, p)) {
+                conf_[p] = v;
+                edgeConf_[v].push_back(p);
+                break;
+            }
+        }
+    }
+
+    return true;
+}
+
+void RandomizedIncremental2D::insert(unsigned p)
+{
+    if (conf_[p] < 0) {
+        return;
+    }
+
+    // widen seen edge to whole visible chain a..b, edges collinear with p
+    // are taken as well, their inner vertex would not stay on hull
+    unsigned a = conf_[p], b = next_[a];
+    while (cross(xar_[prev_[a]], yar_[prev_[a]], xar_[a], yar_[a],
+                 xar_[p], yar_[p]) > -EPS && prev_[a] != b) {
+        a = prev_[a];
+    }
+    while (cross(xar_[b], yar_[b], xar_[next_[b]], yar_[next_[b]],
+                 xar_[p], yar_[p]) > -EPS && next_[b] != a) {
+        b = next_[b];
+    }
+
+    // collect conflicts of removed edges
+    std::vector<unsigned> moved;
+    for (unsigned v = a; v != b; v = next_[v]) {
+        moved.insert(moved.end(), edgeConf_[v].begin(), edgeConf_[v].end());
+        edgeConf_[v].clear();
+        edgeConf_[v].shrink_to_fit();
+    }
+
+    next_[a] = p;
+    prev_[p] = a;
+    next_[p] = b;
+    prev_[b] = p;
+    start_ = p;
+    conf_[p] = -1;
+
+    // point outside of new hull has to see one of new edges
+    for (auto q : moved) {
+        if (q == p) {
+            continue;
+        }
+        if (sees(a, q)) {
+            conf_[q] = a;
+            edgeConf_[a].push_back(q);
+        } else if (sees(p, q)) {
+            conf_[q] = p;
+            edgeConf_[p].push_back(q);
+        } else {
+            conf_[q] = -1;
+        }
+    }
+}
+
+bool RandomizedIncremental2D::sees(unsigned v, unsigned p)
+{
+    unsigned w = next_[v];
+    return cross(xar_[v], yar_[v], xar_[w], yar_[w], xar_[p], yar_[p]) > EPS;
+}
+
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <vector>
+#include <random>
+#include <algorithm>
+
+#include "lib/structures.h"
+#include "lib/geometry.h"
+#include "solvers/solver_2d.h"
+#include "solvers/small_hull_2d.h"
+
+namespace ch
+{
+
+/**
+ * Randomized incremental solver.
+ *
+ * Points are inserted in random order. Every point not yet inserted keeps
+ * one hull edge it sees (its conflict), every edge keeps list of points
+ * conflicting with it, so only points of removed edges are retested after
+ * insertion. Runs in expected O(n log n).
+ */
+class RandomizedIncremental2D : public Solver2D
+{
+    public:
+        RandomizedIncremental2D();
+
+        /**
+         * Constructor.
+         *
+         * @param seed seed of insertion order, same seed gives same run
+         */
+        RandomizedIncremental2D(unsigned seed);
+
+        Points2D& solve(const Points2D& input, Points2D& output);
+
+    private:
+        /**
+         * Builds initial triangle and conflicts of remaining points
+         *
+         * @param order point ids in insertion order, first three of them
+         *              are rearranged to form the triangle
+         * @return false if all points lie on one line
+         */
+        bool init(std::vector<unsigned>& order);
+
+        /** Inserts point to hull, if it lies outside of it */
+        void insert(unsigned p);
+
+        /** Whether point p lies strictly outside of edge starting at v */
+        bool sees(unsigned v, unsigned p);
+
+        /** Cached coordinates of input */
+        std::vector<double> xar_, yar_;
+
+        /** Neighbours of hull vertices, in output order */
+        std::vector<unsigned> next_, prev_;
+
+        /** Start of edge seen by uninserted point, -1 if point is inside */
+        std::vector<int> conf_;
+
+        /** Points conflicting with edge, indexed by its start */
+        std::vector<std::vector<unsigned> > edgeConf_;
+
+        /** Any hull vertex, to start output from */
+        unsigned start_;
+
+        std::mt19937 rng_;
+};
+
+}
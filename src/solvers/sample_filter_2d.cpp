@@ -0,0 +1,85 @@
+#include "solvers/sample_filter_2d.h"
+
+namespace ch
+{
+
+SampleFilter2D::SampleFilter2D()
+{
+    name_ = "Sample Filter";
+    filterThreshold_ = 1000;
+    rng_.seed(1);
+    variant_ = SEQ;
+}
+
+SampleFilter2D::SampleFilter2D(Variant v)
+{
+    name_ = "Sample Filter";
+    filterThreshold_ = 1000;
+    rng_.seed(1);
+    variant_ = v;
+}
+
+SampleFilter2D::SampleFilter2D(Variant v, unsigned seed)
+{
+    name_ = "Sample Filter";
+    filterThreshold_ = 1000;
+    rng_.seed(seed);
+    variant_ = v;
+}
+
+Points2D& SampleFilter2D::solve(const Points2D& input, Points2D& output)
+{
+    SolveScope scope(*this, output);
+    if (input.getSize() <= SmallHull2D::TINY_SIZE) {
+        return scope.delegated(SmallHull2D::solveTiny(input, output));
+    }
+
+    MonotoneChain2D exact;
+    if (input.getSize() < filterThreshold_) {
+        return scope.delegated(exact.solve(input, output));
+    }
+
+    const data_t& inputData = input.getData();
+    int n = inputData.size();
+
+    // hull of random sample
+    unsigned s = sqrt(n);
+    std::uniform_int_distribution<unsigned> pick(0, n - 1);
+    Points2D sample, sampleHull;
+    for (unsigned i = 0; i < s; i++) {
+        sample.add(inputData[pick(rng_)]);
+    }
+    exact.solve(sample, sampleHull);
+    if (sampleHull.getSize() < 3) {
+        return scope.delegated(exact.solve(input, output));
+    }
+
+    const data_t& hullData = sampleHull.getData();
+    hullX_.resize(hullData.size());
+    hullY_.resize(hullData.size());
+    for (unsigned i = 0; i < hullData.size(); i++) {
+        hullX_[i] = hullData[i][0];
+        hullY_[i] = hullData[i][1];
+    }
+
+    // classify, vertices of sample hull lie on its border and are kept
+    std::vector<char> keep(n);
+#pragma omp parallel for default(shared) schedule(static) \
+        if(variant_ == PARA)
+    for (int i = 0; i < n; i++) {
+        keep[i] = !ptInHull(hullX_.data(), hullY_.data(), hullX_.size(),
+                            inputData[i][0], inputData[i][1]);
+    }
+
+    Points2D rest;
+    for (int i = 0; i < n; i++) {
+        if (keep[i]) {
+            rest.add(inputData[i]);
+        }
+    }
+    R("Sample filter kept " << rest.getSize() << " of " << n)
+
+    return scope.delegated(exact.solve(rest, output));
+}
+
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <vector>
+#include <random>
+#include <cmath>
+#include <omp.h>
+
+#include "lib/structures.h"
+#include "lib/geometry.h"
+#include "solvers/solver_2d.h"
+#include "solvers/small_hull_2d.h"
+#include "solvers/monotone_chain_2d.h"
+
+namespace ch
+{
+
+/**
+ * Random sampling filter in the style of Clarkson and Shor.
+ *
+ * Hull of random sample of about sqrt(n) points is found first, then all
+ * points are classified against it by O(log s) point in polygon test.
+ * Only points not strictly inside of sample hull are passed to final
+ * solver. Classification of points is independent, so it runs in parallel.
+ */
+class SampleFilter2D : public Solver2D
+{
+    public:
+        SampleFilter2D();
+
+        Points2D& solve(const Points2D& input, Points2D& output);
+
+        /** Version switcher, parallel version classifies points in parallel */
+        enum Variant {SEQ, PARA};
+        SampleFilter2D(Variant v);
+
+        /**
+         * Constructor.
+         *
+         * @param v variant of solver
+         * @param seed seed of sampling, same seed gives same sample
+         */
+        SampleFilter2D(Variant v, unsigned seed);
+
+    private:
+        /** Cached vertices of sample hull, in output order */
+        std::vector<double> hullX_, hullY_;
+
+        /** Minimal size of input to be filtered */
+        unsigned filterThreshold_;
+
+        std::mt19937 rng_;
+
+        Variant variant_;
+};
+
+}
@@ -0,0 +1,164 @@
+#include "solvers/sliding_window_hull_2d.h"
+
+namespace ch
+{
+
+SlidingWindowHull2D::SlidingWindowHull2D(double window)
+{
+    window_ = window;
+    now_ = -INFINITY;
+    blockSize_ = 1024;
+    size_ = 0;
+    frontStart_ = 0;
+    dirty_ = false;
+}
+
+SlidingWindowHull2D::SlidingWindowHull2D(double window, unsigned blockSize)
+{
+    window_ = window;
+    now_ = -INFINITY;
+    blockSize_ = std::max(1U, blockSize);
+    size_ = 0;
+    frontStart_ = 0;
+    dirty_ = false;
+}
+
+void SlidingWindowHull2D::insert(const point2d_t& pt, double time)
+{
+    now_ = std::max(now_, time);
+    backPts_.push_back(pt);
+    backTimes_.push_back(time);
+    size_++;
+
+    // point inside of back hull does not change hull of window
+    if (backHull_.insert(pt)) {
+        dirty_ = true;
+    }
+    expire();
+}
+
+void SlidingWindowHull2D::advance(double time)
+{
+    now_ = std::max(now_, time);
+    expire();
+}
+
+unsigned SlidingWindowHull2D::getSize() const
+{
+    return size_;
+}
+
+const Points2D& SlidingWindowHull2D::getHull()
+{
+    if (!dirty_) {
+        return hull_;
+    }
+
+    // rest of oldest block, suffix of newer blocks and back stack
+    Points2D backHull;
+    backHull_.getHull(backHull);
+    HullSummary window(backHull);
+    if (!front_.empty()) {
+        if (frontStart_ == 0) {
+            window = HullSummary::merge(window, front_.back().suffix);
+        } else {
+            // only points out of hull of newer ones in block can be on
+            // hull of its rest, they are found and sorted at first read
+            Block& oldest = front_.back();
+            if (oldest.order.empty()) {
+                DynamicHull2D newer;
+                std::vector<std::pair<point2d_t, unsigned>> ranked;
+                for (int i = (int) oldest.pts.size() - 1; i >= 0; i--) {
+                    if (newer.insert(oldest.pts[i])) {
+                        ranked.push_back({oldest.pts[i], i});
+                    }
+                }
+                std::sort(ranked.begin(), ranked.end());
+                for (auto& item : ranked) {
+                    oldest.order.push_back(item.second);
+                }
+            }
+            pts_.clear();
+            for (unsigned i : oldest.order) {
+                if (i >= frontStart_) {
+                    pts_.push_back(oldest.pts[i]);
+                }
+            }
+            window = HullSummary::merge(window,
+                                        HullSummary(pts_.data(), pts_.size()));
+            if (front_.size() > 1) {
+                window = HullSummary::merge(
+                    window, front_[front_.size() - 2].suffix);
+            }
+        }
+    }
+
+    hull_.clear();
+    window.getHull(hull_);
+    dirty_ = false;
+    return hull_;
+}
+
+void SlidingWindowHull2D::expire()
+{
+    double limit = now_ - window_;
+    while (size_ > 0) {
+        if (front_.empty()) {
+            if (backTimes_.front() > limit) {
+                return;
+            }
+            flip();
+        }
+
+        Block& oldest = front_.back();
+        if (oldest.times.back() <= limit) {
+            // whole block expired
+            size_ -= oldest.pts.size() - frontStart_;
+            front_.pop_back();
+            frontStart_ = 0;
+        } else if (oldest.times[frontStart_] <= limit) {
+            size_--;
+            frontStart_++;
+        } else {
+            return;
+        }
+        dirty_ = true;
+    }
+}
+
+void SlidingWindowHull2D::flip()
+{
+    unsigned n = backPts_.size(),
+             blocks = (n + blockSize_ - 1) / blockSize_;
+    front_.resize(blocks);
+    frontStart_ = 0;
+
+    // newest block first, each one extends hull of newer ones
+    for (unsigned b = 0; b < blocks; b++) {
+        Block& block = front_[b];
+        unsigned from = (blocks - 1 - b) * blockSize_,
+                 to = std::min(n, from + blockSize_);
+        block.pts.assign(backPts_.begin() + from, backPts_.begin() + to);
+        block.times.assign(backTimes_.begin() + from,
+                           backTimes_.begin() + to);
+
+        block.order.clear();
+        pts_.assign(block.pts.begin(), block.pts.end());
+        hullPts_.resize(2 * pts_.size());
+        unsigned h = SmallHull2D::hull(pts_.data(), pts_.size(),
+                                       hullPts_.data());
+        std::sort(hullPts_.begin(), hullPts_.begin() + h);
+
+        block.suffix = HullSummary(hullPts_.data(), h);
+        if (b > 0) {
+            block.suffix = HullSummary::merge(block.suffix,
+                                              front_[b - 1].suffix);
+        }
+    }
+
+    backPts_.clear();
+    backTimes_.clear();
+    backHull_.clear();
+}
+
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <vector>
+
+#include "lib/structures.h"
+#include "lib/geometry.h"
+#include "solvers/hull_summary_2d.h"
+#include "solvers/dynamic_hull_2d.h"
+
+namespace ch
+{
+
+/**
+ * Convex hull of points from sliding time window.
+ *
+ * Window is kept as queue made of two stacks. New points go to back stack,
+ * whose hull is maintained incrementally. Once oldest point expires and
+ * front stack is empty, back stack is moved to front in blocks, each block
+ * storing hull of itself and all newer blocks as sorted chains. Points are
+ * thus processed in O(log n) amortized time. Hull of window is merged from
+ * at most three parts when it is asked for after change, in O(B + h) for
+ * block size B. Rest of oldest block is read from its points out of hull
+ * of newer points, sorted once at the first read of block.
+ */
+class SlidingWindowHull2D
+{
+    public:
+        /**
+         * Constructor.
+         *
+         * @param window points older than this are dropped
+         */
+        SlidingWindowHull2D(double window);
+
+        /**
+         * Constructor.
+         *
+         * @param window points older than this are dropped
+         * @param blockSize number of points in block of front stack
+         */
+        SlidingWindowHull2D(double window, unsigned blockSize);
+
+        /**
+         * Adds point, moves time to its timestamp and drops expired points
+         *
+         * @param pt inserted point
+         * @param time timestamp of point, not lower than previous ones
+         */
+        void insert(const point2d_t& pt, double time);
+
+        /** Moves time forward and drops expired points */
+        void advance(double time);
+
+        /** Number of points in window */
+        unsigned getSize() const;
+
+        /** Hull of points in window, recomputed only after change */
+        const Points2D& getHull();
+
+    private:
+        /** Consecutive points of front stack */
+        struct Block {
+            std::vector<point2d_t> pts;
+            std::vector<double> times;
+
+            /**
+             * Indices of points out of hull of newer points of block, in
+             * lexicographic order, found at first read of block
+             */
+            std::vector<unsigned> order;
+
+            /** Hull of this block and all newer ones */
+            HullSummary suffix;
+        };
+
+        /** Drops points with timestamp out of window */
+        void expire();
+
+        /** Moves back stack to front one */
+        void flip();
+
+        double window_, now_;
+        unsigned blockSize_, size_;
+
+        /** Blocks from newest to oldest, first points of last one expired */
+        std::vector<Block> front_;
+        unsigned frontStart_;
+
+        std::vector<point2d_t> backPts_;
+        std::vector<double> backTimes_;
+        DynamicHull2D backHull_;
+
+        Points2D hull_;
+        bool dirty_;
+
+        /** Buffers reused between merges */
+        std::vector<point2d_t> pts_, hullPts_;
+};
+
+}
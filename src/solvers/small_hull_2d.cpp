@@ -0,0 +1,188 @@
+#include "solvers/small_hull_2d.h"
+
+namespace ch
+{
+
+SmallHull2D::SmallHull2D()
+{
+    name_ = "Small Hull";
+}
+
+Points2D& SmallHull2D::solve(const Points2D& input, Points2D& output)
+{
+    SolveScope scope(*this, output);
+    const data_t& inputData = input.getData();
+    unsigned n = inputData.size();
+    pts_.resize(n);
+    hull_.resize(2 * n);
+    for (unsigned i = 0; i < n; i++) {
+        pts_[i] = {inputData[i][0], inputData[i][1]};
+    }
+
+    unsigned h = hull(pts_.data(), n, hull_.data());
+    for (unsigned i = 0; i < h; i++) {
+        emit(output, {hull_[i].first, hull_[i].second});
+    }
+    return output;
+}
+
+unsigned SmallHull2D::hull(point2d_t* pts, unsigned n, point2d_t* hull)
+{
+    if (n == 0) {
+        return 0;
+    }
+
+    if (n >= FILTER_THRESHOLD) {
+        n = filter(pts, n);
+    }
+    if (n <= TINY_SIZE) {
+        sortTiny(pts, n);
+    } else {
+        std::sort(pts, pts + n);
+    }
+    return hullSorted(pts, n, hull);
+}
+
+unsigned SmallHull2D::hullSorted(const point2d_t* pts, unsigned n,
+                                 point2d_t* hull)
+{
+    if (n == 0) {
+        return 0;
+    }
+    if (fabs(pts[0].first - pts[n - 1].first) < EPS
+        && fabs(pts[0].second - pts[n - 1].second) < EPS) {
+        hull[0] = pts[0];
+        return 1;
+    }
+
+    // upper chain from left to right, then lower one back, both turn right
+    unsigned k = 0;
+    for (unsigned i = 0; i < n; i++) {
+        while (k >= 2 && !ccw(hull[k - 2].first, hull[k - 2].second,
+                              hull[k - 1].first, hull[k - 1].second,
+                              pts[i].first, pts[i].second)) {
+            k--;
+        }
+        hull[k++] = pts[i];
+    }
+    for (int i = n - 2, t = k + 1; i >= 0; i--) {
+        while (k >= (unsigned) t && !ccw(hull[k - 2].first, hull[k - 2].second,
+                                         hull[k - 1].first, hull[k - 1].second,
+                                         pts[i].first, pts[i].second)) {
+            k--;
+        }
+        hull[k++] = pts[i];
+    }
+
+    // last point closes the polygon
+    return k - 1;
+}
+
+Points2D& SmallHull2D::solveTiny(const Points2D& input, Points2D& output)
+{
+    const data_t& inputData = input.getData();
+    unsigned n = inputData.size();
+    point2d_t pts[TINY_SIZE], hullPts[2 * TINY_SIZE];
+    for (unsigned i = 0; i < n; i++) {
+        pts[i] = {inputData[i][0], inputData[i][1]};
+    }
+
+    unsigned h = hull(pts, n, hullPts);
+    for (unsigned i = 0; i < h; i++) {
+        output.add({hullPts[i].first, hullPts[i].second});
+    }
+    return output;
+}
+
+void SmallHull2D::sortTiny(point2d_t* pts, unsigned n)
+{
+    // padding points are larger than any input
+    double xs[TINY_SIZE], ys[TINY_SIZE];
+    for (unsigned i = 0; i < TINY_SIZE; i++) {
+        xs[i] = i < n ? pts[i].first : DBL_MAX;
+        ys[i] = i < n ? pts[i].second : DBL_MAX;
+    }
+
+    if (n <= TINY_SIZE / 2) {
+        rankSort<TINY_SIZE / 2>(xs, ys, n, pts);
+    } else {
+        rankSort<TINY_SIZE>(xs, ys, n, pts);
+    }
+}
+
+template<unsigned N>
+void SmallHull2D::rankSort(const double* xs, const double* ys, unsigned n,
+                           point2d_t* sorted)
+{
+    for (unsigned i = 0; i < n; i++) {
+        unsigned rank = 0;
+        for (unsigned j = 0; j < N; j++) {
+            rank += (xs[j] < xs[i])
+                    | ((xs[j] == xs[i]) & ((ys[j] < ys[i])
+                                           | ((ys[j] == ys[i]) & (j < i))));
+        }
+        sorted[rank] = {xs[i], ys[i]};
+    }
+}
+
+unsigned SmallHull2D::filter(point2d_t* pts, unsigned n)
+{
+    // extremes in x, y and both diagonals, in output order, all directions
+    // turned to maximization
+    unsigned ext[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    double best[8];
+    const double dirX[8] = {-1, -1, 0, 1, 1, 1, 0, -1},
+                 dirY[8] = {0, 1, 1, 1, 0, -1, -1, -1};
+    for (unsigned e = 0; e < 8; e++) {
+        best[e] = dirX[e] * pts[0].first + dirY[e] * pts[0].second;
+    }
+    for (unsigned i = 1; i < n; i++) {
+        for (unsigned e = 0; e < 8; e++) {
+            double val = dirX[e] * pts[i].first + dirY[e] * pts[i].second;
+            ext[e] = val > best[e] ? i : ext[e];
+            best[e] = std::max(best[e], val);
+        }
+    }
+
+    point2d_t poly[8];
+    unsigned k = 0;
+    for (unsigned e = 0; e < 8; e++) {
+        if (k == 0 || dist(pts[ext[e]], poly[k - 1]) > EPS) {
+            poly[k++] = pts[ext[e]];
+        }
+    }
+    while (k > 1 && dist(poly[0], poly[k - 1]) < EPS) {
+        k--;
+    }
+    if (k < 3) {
+        return n;
+    }
+
+    // edges turning right, missing ones repeat the first, cross product
+    // is kept in form exact for polygon vertices
+    double edgeX[8], edgeY[8], endX[8], endY[8];
+    for (unsigned e = 0; e < 8; e++) {
+        const point2d_t& a = poly[e < k ? e : 0],
+                       & b = poly[e < k ? (e + 1) % k : 1];
+        edgeX[e] = a.first - b.first;
+        edgeY[e] = a.second - b.second;
+        endX[e] = b.first;
+        endY[e] = b.second;
+    }
+
+    // keep points not strictly inside of octagon, without branches
+    unsigned kept = 0;
+    for (unsigned i = 0; i < n; i++) {
+        point2d_t pt = pts[i];
+        bool inside = 1;
+        for (unsigned e = 0; e < 8; e++) {
+            inside &= edgeX[e] * (endY[e] - pt.second)
+                      - edgeY[e] * (endX[e] - pt.first) < -EPS;
+        }
+        pts[kept] = pt;
+        kept += !inside;
+    }
+    return kept;
+}
+
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cfloat>
+
+#include "lib/structures.h"
+#include "lib/geometry.h"
+#include "solvers/solver_2d.h"
+
+namespace ch
+{
+
+/**
+ * Solver for small inputs.
+ *
+ * Monotone chain over plain coordinate buffer, without index arrays or
+ * other allocations, meant for many independent groups of up to few
+ * thousand points. Tiny inputs are sorted on the stack by branch-free
+ * rank counting, other solvers hand such inputs over by solveTiny.
+ */
+class SmallHull2D : public Solver2D
+{
+    public:
+        SmallHull2D();
+
+        Points2D& solve(const Points2D& input, Points2D& output);
+
+        /**
+         * Finds hull of points in buffer
+         *
+         * @param pts n points, sorted in place
+         * @param n number of points
+         * @param hull output buffer, with space for 2n points
+         * @return number of points on hull, stored in output order
+         */
+        static unsigned hull(point2d_t* pts, unsigned n, point2d_t* hull);
+
+        /**
+         * Finds hull of lexicographically sorted points in linear time
+         *
+         * @param pts n sorted points
+         * @param n number of points
+         * @param hull output buffer, with space for 2n points
+         * @return number of points on hull, stored in output order
+         */
+        static unsigned hullSorted(const point2d_t* pts, unsigned n,
+                                   point2d_t* hull);
+
+        /**
+         * Finds hull of tiny input, used by all solvers below TINY_SIZE
+         *
+         * @param input at most TINY_SIZE points
+         * @param output hull of input
+         * @return Same as output param, reference to result
+         */
+        static Points2D& solveTiny(const Points2D& input, Points2D& output);
+
+        /** Maximal size of input handled as tiny one */
+        static const unsigned TINY_SIZE = 32;
+
+    private:
+        /** Sorts at most TINY_SIZE points lexicographically */
+        static void sortTiny(point2d_t* pts, unsigned n);
+
+        /**
+         * Sorts points lexicographically by counting their ranks
+         *
+         * Every point is compared with all N slots without branches, which
+         * vectorizes for fixed N. Equal points are ranked by position.
+         *
+         * @param xs x coordinates, padded to N by DBL_MAX
+         * @param ys y coordinates, padded to N by DBL_MAX
+         * @param n number of points
+         * @param sorted output buffer for n points
+         */
+        template<unsigned N>
+        static void rankSort(const double* xs, const double* ys, unsigned n,
+                             point2d_t* sorted);
+
+        /**
+         * Drops points strictly inside of polygon of extremes in eight
+         * directions (Akl-Toussaint heuristic)
+         *
+         * @return number of kept points, moved to front of buffer
+         */
+        static unsigned filter(point2d_t* pts, unsigned n);
+
+        /** Minimal number of points to be filtered before sorting */
+        static const unsigned FILTER_THRESHOLD = 64;
+
+        /** Buffers reused between calls */
+        std::vector<point2d_t> pts_, hull_;
+};
+
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "lib/structures.h"
+#include "solvers/hull_stats_2d.h"
 
 namespace ch
 {
@@ -11,11 +12,15 @@ namespace ch
 class Solver2D
 {
     public:
+        Solver2D() { statsEnabled_ = false; }
         virtual ~Solver2D() {}
 
         /**
          * Find convex hull of input data set.
          *
+         * Hull vertices go clockwise from the lexicographically smallest
+         * one, for every solver and input size.
+         *
          * @param inputSet Input data set
          * @return Convex hull of input data set.
          */
@@ -23,9 +28,68 @@ class Solver2D
 
         inline std::string getName() { return name_; }
 
+        /**
+         * Switches accumulating of hull measures while solver emits hull,
+         * off by default
+         */
+        inline void setStats(bool enabled) { statsEnabled_ = enabled; }
+
+        /** Measures of hull found by last solve, if switched on */
+        inline HullStats getStats() const { return stats_.result(); }
+
     protected:
+        /** Adds hull vertex to output, accumulates measures if enabled */
+        inline void emit(Points2D& output, const point_t& pt)
+        {
+            if (statsEnabled_) {
+                stats_.add(pt[0], pt[1]);
+            }
+            output.add(pt);
+        }
+
+        /**
+         * Guard of solve, resets measures on its start. Solvers emit whole
+         * hull in the order of solver output themselves, see
+         * Points2D::orderHull.
+         */
+        class SolveScope
+        {
+            public:
+                SolveScope(Solver2D& solver, Points2D& output)
+                    : solver_(solver), start_(output.getSize())
+                {
+                    solver_.stats_.reset();
+                }
+
+                /**
+                 * Accumulates measures of vertices written by other solver,
+                 * as by solvers used for tiny inputs, if enabled
+                 *
+                 * @param output output of solve, written past its start
+                 * @return Same as output param, reference to result
+                 */
+                Points2D& delegated(Points2D& output)
+                {
+                    if (solver_.statsEnabled_) {
+                        const data_t& data = output.getData();
+                        solver_.stats_.reset();
+                        for (unsigned i = start_; i < data.size(); i++) {
+                            solver_.stats_.add(data[i][0], data[i][1]);
+                        }
+                    }
+                    return output;
+                }
+
+            private:
+                Solver2D& solver_;
+                unsigned start_;
+        };
+
         /** name of solver */
         std::string name_;
+
+        bool statsEnabled_;
+        HullStatsAccumulator stats_;
 };
 
 }
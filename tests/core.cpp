@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "cheetah/core.h"
+#include "lib/generator.h"
+
+TEST(AutoSelectTest, Selection)
+{
+    ch::Generator2D generator;
+    ch::Points2D points;
+
+    generator.genUniformCircle(20, 5, 1000, points);
+    EXPECT_EQ(ch::ANDREW, ch::selectSolver(points, 1));
+    points.clear();
+
+    generator.genUniformCircle(100000, 3, 100000, points);
+    EXPECT_EQ(ch::JARVIS, ch::selectSolver(points, 1));
+    points.clear();
+
+    generator.genUniformCircle(100000, 100000, 100000, points);
+    EXPECT_EQ(ch::OUELLET, ch::selectSolver(points, 1));
+    EXPECT_EQ(ch::DIVIDE, ch::selectSolver(points, 4));
+
+    ch::Calibration saved = ch::getCalibration();
+    EXPECT_FALSE(ch::loadCalibration("tests/files/missing.cfg"));
+    ASSERT_TRUE(ch::loadCalibration("tests/files/calibration.cfg"));
+    EXPECT_EQ(10U, ch::getCalibration().smallN);
+    EXPECT_EQ(saved.parallelMinN, ch::getCalibration().parallelMinN);
+    points.clear();
+    generator.genUniformCircle(100000, 3, 100000, points);
+    EXPECT_EQ(ch::QUICKHULL, ch::selectSolver(points, 1));
+
+    // thresholds are global, later tests need the default ones
+    ch::setCalibration(saved);
+    EXPECT_EQ(saved.smallN, ch::getCalibration().smallN);
+}
+
+TEST(AutoSelectTest, Generated)
+{
+    ch::Generator2D generator;
+    for (long long h : {3, 10, 1000, 20000}) {
+        ch::Points2D points, output;
+        generator.genUniformCircle(20000, h, 100000, points);
+        ch::findHull(points, output, ch::AUTO);
+        EXPECT_EQ(h, output.getSize());
+        output.clear();
+        ch::findHullParallel(points, output, ch::AUTO, 2);
+        EXPECT_EQ(h, output.getSize());
+    }
+}
+
+TEST(BatchTest, Generated)
+{
+    ch::Generator2D generator;
+    std::vector<double> coords, hullCoords;
+    std::vector<size_t> offsets(1, 0), hullOffsets;
+    std::vector<unsigned> sizes;
+    // single point set first
+    coords = {1, 1};
+    offsets.push_back(1);
+    sizes.push_back(1);
+
+    std::vector<std::pair<long long, long long> > sets = {{2, 2}, {6, 3},
+        {6, 6}, {50, 3}, {50, 25}, {100, 10}, {1000, 3}, {1000, 500},
+        {1000, 1000}};
+    for (auto& set : sets) {
+        ch::Points2D points;
+        ASSERT_TRUE(generator.genUniformCircle(set.first, set.second, 100000,
+                                               points));
+        for (auto& pt : points.getData()) {
+            coords.push_back(pt[0]);
+            coords.push_back(pt[1]);
+        }
+        offsets.push_back(offsets.back() + set.first);
+        sizes.push_back(set.second);
+    }
+
+    ch::findHullBatch(coords, offsets, hullCoords, hullOffsets, 2);
+    ASSERT_EQ(offsets.size(), hullOffsets.size());
+    EXPECT_EQ(2 * hullOffsets.back(), hullCoords.size());
+    for (unsigned s = 0; s < sizes.size(); s++) {
+        EXPECT_EQ(sizes[s], hullOffsets[s + 1] - hullOffsets[s]);
+    }
+
+    ch::findHullBatch(coords, std::vector<size_t>(), hullCoords,
+                      hullOffsets, 2);
+    EXPECT_EQ(1U, hullOffsets.size());
+    EXPECT_TRUE(hullCoords.empty());
+}
+
+TEST(UpdateHullTest, Generated)
+{
+    ch::Generator2D generator;
+    for (long long h : {3, 100, 2000}) {
+        ch::Points2D points, base, batch, baseHull, expected;
+        generator.genUniformCircle(20000, h, 100000, points);
+
+        // every 20th point comes in later batch
+        const ch::data_t& data = points.getData();
+        for (unsigned i = 0; i < data.size(); i++) {
+            (i % 20 ? base : batch).add(data[i]);
+        }
+        ch::findHull(base, baseHull);
+        ch::findHull(points, expected);
+
+        ch::Points2D updated, updatedParallel;
+        ch::updateHull(baseHull, batch, updated);
+        EXPECT_EQ(expected.getSize(), updated.getSize());
+        ch::updateHullParallel(baseHull, batch, updatedParallel, 4);
+        EXPECT_EQ(expected.getSize(), updatedParallel.getSize());
+
+        // nothing new, or nothing known
+        ch::Points2D same, fromEmpty, empty;
+        ch::updateHull(expected, base, same);
+        EXPECT_EQ(expected.getSize(), same.getSize());
+        ch::updateHull(empty, points, fromEmpty);
+        EXPECT_EQ(expected.getSize(), fromEmpty.getSize());
+    }
+}
+
+TEST(StreamTest, Chunks)
+{
+    ch::Generator2D generator;
+    ch::Points2D points, expected;
+    generator.genUniformCircle(20000, 500, 100000, points);
+    ch::findHull(points, expected);
+
+    std::stringstream text, binary;
+    text << points.getSize() << std::endl;
+    text.precision(17);
+    for (auto& pt : points.getData()) {
+        text << pt[0] << " " << pt[1] << std::endl;
+        binary.write((const char*) pt.data(), 2 * sizeof(double));
+    }
+
+    for (unsigned chunk : {1U, 777U, 100000U}) {
+        ch::Points2D fromText, fromBinary;
+        text.clear();
+        text.seekg(0);
+        binary.clear();
+        binary.seekg(0);
+        ASSERT_TRUE(ch::findHullStream(text, ch::TEXT, fromText,
+                                       ch::QUICKHULL, chunk, 1));
+        ASSERT_TRUE(ch::findHullStream(binary, ch::BINARY, fromBinary,
+                                       ch::OUELLET, chunk, 2));
+        EXPECT_EQ(expected.getSize(), fromText.getSize());
+        EXPECT_EQ(expected.getSize(), fromBinary.getSize());
+    }
+
+    // truncated inputs
+    std::stringstream shortText("3\n1 2\n3 4\n"), shortBinary("12345");
+    ch::Points2D output;
+    EXPECT_FALSE(ch::findHullStream(shortText, ch::TEXT, output,
+                                    ch::QUICKHULL, 100, 1));
+    EXPECT_FALSE(ch::findHullStream(shortBinary, ch::BINARY, output,
+                                    ch::QUICKHULL, 100, 1));
+    EXPECT_EQ(0U, output.getSize());
+}
@@ -0,0 +1,464 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <algorithm>
+#include <sstream>
+
+#include "lib/structures.h"
+#include "lib/generator.h"
+#include "solvers/monotone_chain_2d.h"
+#include "solvers/dynamic_hull_2d.h"
+#include "solvers/fully_dynamic_hull_2d.h"
+#include "solvers/sliding_window_hull_2d.h"
+#include "solvers/kinetic_hull_2d.h"
+#include "solvers/hull_summary_2d.h"
+#include "solvers/hull_query_2d.h"
+#include "solvers/hull_support_2d.h"
+#include "approximators/epskernel2d.h"
+
+TEST(DynamicHull2DTest, Generated)
+{
+    ch::Generator2D generator;
+    for (long long h : {3, 10, 100, 1000}) {
+        ch::Points2D points, hull, expected;
+        generator.genUniformCircle(5000, h, 100000, points);
+
+        ch::DynamicHull2D dynamic;
+        for (auto& pt : points.getData()) {
+            dynamic.insert({pt[0], pt[1]});
+        }
+        EXPECT_EQ(h, dynamic.getSize());
+        dynamic.getHull(hull);
+        EXPECT_EQ(h, hull.getSize());
+
+        ch::MonotoneChain2D solver;
+        solver.solve(points, expected);
+        EXPECT_EQ(expected.getSize(), hull.getSize());
+    }
+}
+
+TEST(DynamicHull2DTest, Queries)
+{
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> coord(-50, 50);
+    ch::DynamicHull2D dynamic;
+    std::vector<ch::point2d_t> inserted;
+
+    for (int i = 0; i < 300; i++) {
+        ch::point2d_t pt = {coord(rng), coord(rng)};
+        dynamic.insert(pt);
+        inserted.push_back(pt);
+
+        // hull after every insertion matches static solver
+        ch::Points2D points, expected, hull;
+        for (auto& p : inserted) {
+            points.add({p.first, p.second});
+        }
+        ch::MonotoneChain2D solver;
+        solver.solve(points, expected);
+        dynamic.getHull(hull);
+        ASSERT_EQ(expected.getSize(), dynamic.getSize());
+        ASSERT_EQ(expected.getSize(), hull.getSize());
+
+        // extreme points reach maximal dot product of all inserted points
+        for (int d = 0; d < 16; d++) {
+            double dx = coord(rng), dy = coord(rng);
+            if (dx == 0 && dy == 0) {
+                continue;
+            }
+            double best = -1e300;
+            for (auto& p : inserted) {
+                best = std::max(best, dx * p.first + dy * p.second);
+            }
+            ch::point2d_t ext = dynamic.extreme(dx, dy);
+            EXPECT_EQ(best, dx * ext.first + dy * ext.second);
+        }
+    }
+
+    // grid points are inside exactly if they are not outside any edge
+    ch::Points2D hull;
+    dynamic.getHull(hull);
+    const ch::data_t& data = hull.getData();
+    for (int x = -55; x <= 55; x += 5) {
+        for (int y = -55; y <= 55; y += 5) {
+            bool inside = true;
+            for (unsigned i = 0; i < data.size(); i++) {
+                const ch::point_t& a = data[i], & b = data[(i + 1) % data.size()];
+                if (ch::cross(a[0], a[1], b[0], b[1], x, y) > ch::EPS) {
+                    inside = false;
+                }
+            }
+            EXPECT_EQ(inside, dynamic.contains({x, y}));
+        }
+    }
+}
+
+TEST(FullyDynamicHull2DTest, Updates)
+{
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> coord(-20, 20);
+    ch::FullyDynamicHull2D dynamic;
+    std::vector<unsigned> alive;
+
+    for (int i = 0; i < 2000; i++) {
+        // inserts, removals and moves, duplicates and collinear points
+        // are frequent on small grid
+        unsigned op = rng() % 10;
+        if (alive.empty() || op < 5) {
+            alive.push_back(dynamic.insert({coord(rng), coord(rng)}));
+        } else if (op < 8) {
+            unsigned j = rng() % alive.size();
+            dynamic.remove(alive[j]);
+            alive.erase(alive.begin() + j);
+        } else {
+            dynamic.move(alive[rng() % alive.size()],
+                         {coord(rng), coord(rng)});
+        }
+        ASSERT_EQ(alive.size(), dynamic.getSize());
+        if (alive.empty()) {
+            continue;
+        }
+
+        ch::Points2D points, expected, hull;
+        for (auto id : alive) {
+            const ch::point2d_t& pt = dynamic.getPoint(id);
+            points.add({pt.first, pt.second});
+        }
+        ch::MonotoneChain2D solver;
+        solver.solve(points, expected);
+        dynamic.getHull(hull);
+        ASSERT_EQ(expected.getSize(), hull.getSize());
+
+        // same cycle, possibly from different start
+        const ch::data_t& a = expected.getData(), & b = hull.getData();
+        unsigned shift = std::find(a.begin(), a.end(), b[0]) - a.begin();
+        ASSERT_LT(shift, a.size());
+        for (unsigned j = 0; j < a.size(); j++) {
+            EXPECT_EQ(a[(j + shift) % a.size()], b[j]);
+        }
+
+        std::vector<unsigned> ids;
+        dynamic.getHullIds(ids);
+        ASSERT_EQ(b.size(), ids.size());
+        for (unsigned j = 0; j < ids.size(); j++) {
+            EXPECT_EQ(b[j][0], dynamic.getPoint(ids[j]).first);
+        }
+    }
+}
+
+TEST(SlidingWindowHull2DTest, Stream)
+{
+    std::mt19937 rng(13);
+    std::uniform_real_distribution<double> coord(-1000, 1000);
+    ch::SlidingWindowHull2D window(50, 16);
+    std::vector<std::pair<double, ch::point2d_t> > stream;
+
+    double time = 0;
+    for (int i = 0; i < 3000; i++) {
+        // bursts of points at same time and gaps emptying the window
+        time += (rng() % 100 == 0) ? 80 : (rng() % 3) * 0.5;
+        ch::point2d_t pt = {coord(rng), coord(rng)};
+        window.insert(pt, time);
+        stream.push_back({time, pt});
+        if (i % 7) {
+            continue;
+        }
+
+        ch::Points2D points, expected;
+        for (auto& item : stream) {
+            if (item.first > time - 50) {
+                points.add({item.second.first, item.second.second});
+            }
+        }
+        ASSERT_EQ(points.getSize(), window.getSize());
+        ch::MonotoneChain2D solver;
+        solver.solve(points, expected);
+        ASSERT_EQ(expected.getSize(), window.getHull().getSize());
+    }
+
+    window.advance(time + 100);
+    EXPECT_EQ(0U, window.getSize());
+    EXPECT_EQ(0U, window.getHull().getSize());
+}
+
+TEST(KineticHull2DTest, Frames)
+{
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<double> coord(-1000, 1000), step(-1, 1);
+    std::vector<ch::point2d_t> pts(5000);
+    for (auto& pt : pts) {
+        pt = {coord(rng), coord(rng)};
+    }
+
+    for (auto variant : {ch::KineticHull2D::SEQ, ch::KineticHull2D::PARA}) {
+        ch::KineticHull2D kinetic(variant);
+        for (int frame = 0; frame < 30; frame++) {
+            // small steps, every tenth frame scatters all points
+            for (auto& pt : pts) {
+                if (frame % 10 == 9) {
+                    pt = {coord(rng), coord(rng)};
+                } else {
+                    pt = {pt.first + step(rng), pt.second + step(rng)};
+                }
+            }
+            ch::Points2D points, expected, hull;
+            for (auto& pt : pts) {
+                points.add({pt.first, pt.second});
+            }
+            ch::MonotoneChain2D solver;
+            solver.solve(points, expected);
+            kinetic.solve(points, hull);
+
+            ASSERT_EQ(expected.getSize(), hull.getSize());
+            EXPECT_EQ(frame > 0 && frame % 10 != 9, kinetic.wasRepaired());
+            const std::vector<unsigned>& ids = kinetic.getHullIds();
+            ASSERT_EQ(hull.getSize(), ids.size());
+            for (unsigned i = 0; i < ids.size(); i++) {
+                EXPECT_EQ(pts[ids[i]].first, hull.getData()[i][0]);
+            }
+        }
+    }
+}
+
+TEST(HullSummaryTest, Shards)
+{
+    ch::Generator2D generator;
+    for (long long h : {3, 50, 3000}) {
+        ch::Points2D points, expected;
+        generator.genUniformCircle(30000, h, 100000, points);
+        ch::MonotoneChain2D solver;
+        solver.solve(points, expected);
+
+        // shards by position in input, hulls of some of them are degenerate
+        const ch::data_t& data = points.getData();
+        std::vector<ch::HullSummary> parts;
+        std::vector<unsigned> bounds = {0, 1, 3, 7, 5000, 12000, 29000, 30000};
+        for (unsigned s = 0; s + 1 < bounds.size(); s++) {
+            ch::Points2D shard, shardHull;
+            for (unsigned i = bounds[s]; i < bounds[s + 1]; i++) {
+                shard.add(data[i]);
+            }
+            solver.solve(shard, shardHull);
+            parts.push_back(ch::HullSummary(shardHull));
+        }
+        parts.push_back(ch::HullSummary());
+
+        ch::HullSummary sequential;
+        for (auto& part : parts) {
+            sequential = ch::HullSummary::merge(sequential, part);
+        }
+        ch::HullSummary tree = ch::HullSummary::mergeAll(parts, 4);
+
+        // round trip through binary form
+        std::stringstream stream;
+        tree.write(stream);
+        ch::HullSummary copy;
+        ASSERT_TRUE(copy.read(stream));
+        EXPECT_FALSE(copy.read(stream));
+        stream.clear();
+        tree.write(stream);
+        ASSERT_TRUE(copy.read(stream));
+
+        // truncated form and sizes beyond stream are rejected
+        std::stringstream whole;
+        tree.write(whole);
+        std::string bytes = whole.str();
+        std::stringstream truncated(bytes.substr(0, bytes.size() - 1));
+        ch::HullSummary broken;
+        EXPECT_FALSE(broken.read(truncated));
+        EXPECT_EQ(0U, broken.getSize());
+        uint32_t huge[2] = {0xFFFFFFFFU, 0xFFFFFFFFU};
+        std::stringstream forged(std::string((const char*) huge, sizeof(huge))
+                                 + bytes.substr(sizeof(huge)));
+        EXPECT_FALSE(broken.read(forged));
+
+        ch::Points2D a, b, c;
+        sequential.getHull(a);
+        tree.getHull(b);
+        copy.getHull(c);
+        EXPECT_EQ(expected.getSize(), sequential.getSize());
+        EXPECT_EQ(expected.getSize(), a.getSize());
+        EXPECT_EQ(a.getData(), b.getData());
+        EXPECT_EQ(a.getData(), c.getData());
+    }
+}
+
+TEST(EpsKernel2DTest, Stream)
+{
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> coord(-1000, 1000);
+    ch::Points2D points;
+    for (unsigned i = 0; i < 200000; i++) {
+        double x = coord(rng), y = coord(rng);
+        if (x * x + y * y <= 1000000) {
+            points.add({x, y});
+        }
+    }
+
+    // no point lies farther from kernel hull than reported bound
+    auto check = [&points](const ch::EpsKernel2D& kernel, double eps) {
+        ch::Points2D hull;
+        kernel.getHull(hull);
+        double bound = kernel.errorBound();
+        EXPECT_LE(bound, eps * 2000);
+        EXPECT_LE((int) kernel.getDirections(), kernel.maxReachable());
+
+        const ch::data_t& h = hull.getData();
+        ASSERT_GE(h.size(), 3U);
+        double worst = 0;
+        for (auto& pt : points.getData()) {
+            double d = INFINITY;
+            bool out = false;
+            for (unsigned j = 0; j < h.size(); j++) {
+                const std::vector<double>& a = h[j],
+                                         & b = h[(j + 1) % h.size()];
+                if (ch::cross(a[0], a[1], b[0], b[1], pt[0], pt[1]) > 0) {
+                    out = true;
+                }
+                double ex = b[0] - a[0], ey = b[1] - a[1],
+                       s = ((pt[0] - a[0]) * ex + (pt[1] - a[1]) * ey)
+                           / (ex * ex + ey * ey);
+                s = std::min(1.0, std::max(0.0, s));
+                d = std::min(d, ch::dist(pt[0], pt[1], a[0] + s * ex,
+                                         a[1] + s * ey));
+            }
+            if (out) {
+                worst = std::max(worst, d);
+            }
+        }
+        EXPECT_LE(worst, bound);
+    };
+
+    for (double eps : {0.01, 0.001, 0.0001}) {
+        ch::EpsKernel2D kernel(eps);
+        ch::Points2D hull;
+        kernel.approximate(points, hull);
+        // disk needs about pi / sqrt(eps) anchors
+        EXPECT_LE(kernel.getDirections(), 3.2 / sqrt(eps) + 4);
+        check(kernel, eps);
+    }
+
+    // stream growing from the center doubles frame many times
+    ch::data_t growing = points.getData();
+    std::sort(growing.begin(), growing.end(),
+              [](const std::vector<double>& a, const std::vector<double>& b) {
+                  return a[0] * a[0] + a[1] * a[1] < b[0] * b[0] + b[1] * b[1];
+              });
+    ch::EpsKernel2D kernel(0.001);
+    for (auto& pt : growing) {
+        kernel.add(pt[0], pt[1]);
+    }
+    check(kernel, 0.001);
+}
+
+TEST(HullQuery2DTest, Locate)
+{
+    ch::Generator2D generator;
+    std::mt19937 rng(4);
+    std::uniform_real_distribution<double> coord(-120000, 120000);
+    for (long long h : {3, 10, 1000}) {
+        ch::Points2D points, hull, queries;
+        generator.genUniformCircle(10000, h, 100000, points);
+        ch::MonotoneChain2D solver;
+        solver.solve(points, hull);
+        ch::HullQuery2D query(hull);
+
+        // vertices and edge midpoints lie on boundary, points beyond
+        // vertices outside
+        const ch::data_t& data = hull.getData();
+        for (unsigned i = 0; i < data.size(); i++) {
+            const std::vector<double>& a = data[i],
+                                     & b = data[(i + 1) % data.size()];
+            queries.add({a[0], a[1]});
+            queries.add({(a[0] + b[0]) / 2, (a[1] + b[1]) / 2});
+            queries.add({2 * a[0] - b[0], 2 * a[1] - b[1]});
+        }
+        for (unsigned i = 0; i < 50000; i++) {
+            queries.add({coord(rng), coord(rng)});
+        }
+
+        std::vector<ch::HullQuery2D::Location> results;
+        query.classify(queries, results, 4);
+        ASSERT_EQ(queries.getSize(), results.size());
+        for (unsigned i = 0; i < 3 * data.size(); i++) {
+            EXPECT_EQ(i % 3 == 2 ? ch::HullQuery2D::OUTSIDE
+                                 : ch::HullQuery2D::BOUNDARY, results[i]);
+        }
+        for (unsigned i = 3 * data.size(); i < results.size(); i++) {
+            const ch::point_t& pt = queries.getData()[i];
+            bool in = true;
+            for (unsigned j = 0; j < data.size(); j++) {
+                const std::vector<double>& a = data[j],
+                                         & b = data[(j + 1) % data.size()];
+                if (ch::cross(a[0], a[1], b[0], b[1], pt[0], pt[1]) >= 0) {
+                    in = false;
+                }
+            }
+            EXPECT_EQ(in, results[i] == ch::HullQuery2D::INSIDE);
+            EXPECT_EQ(results[i], query.locate(pt[0], pt[1]));
+        }
+
+        // thread count out of range is clamped
+        std::vector<ch::HullQuery2D::Location> clamped;
+        query.classify(queries, clamped, 0);
+        EXPECT_EQ(results, clamped);
+    }
+
+    // degenerate hulls
+    ch::Points2D segment;
+    segment.add({0, 0});
+    ch::HullQuery2D point(segment);
+    EXPECT_EQ(ch::HullQuery2D::BOUNDARY, point.locate(0, 0));
+    EXPECT_EQ(ch::HullQuery2D::OUTSIDE, point.locate(1, 0));
+    segment.add({4, 2});
+    ch::HullQuery2D line(segment);
+    EXPECT_EQ(ch::HullQuery2D::BOUNDARY, line.locate(2, 1));
+    EXPECT_EQ(ch::HullQuery2D::OUTSIDE, line.locate(6, 3));
+    EXPECT_EQ(ch::HullQuery2D::OUTSIDE, line.locate(2, 1.5));
+    EXPECT_EQ(ch::HullQuery2D::OUTSIDE, ch::HullQuery2D().locate(0, 0));
+}
+
+TEST(HullSupport2DTest, Extreme)
+{
+    ch::Generator2D generator;
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> coord(-1, 1);
+    ch::Points2D directions;
+    for (unsigned i = 0; i < 20000; i++) {
+        directions.add({coord(rng), coord(rng)});
+    }
+    directions.add({0, 1});
+    directions.add({-1, 0});
+
+    std::vector<ch::Points2D> hulls(2);
+    hulls[0].add({3, -2});
+    hulls[1].add({-5, 1});
+    hulls[1].add({4, 7});
+    for (long long h : {3, 10, 1000}) {
+        ch::Points2D points;
+        hulls.push_back(ch::Points2D());
+        generator.genUniformCircle(10000, h, 100000, points);
+        ch::MonotoneChain2D solver;
+        solver.solve(points, hulls.back());
+    }
+
+    for (auto& hull : hulls) {
+        ch::HullSupport2D support(hull);
+        ASSERT_EQ(hull.getSize(), support.getSize());
+
+        // extreme vertex has the largest dot product of all vertices
+        const ch::data_t& data = hull.getData(), & dirs = directions.getData();
+        std::vector<unsigned> results;
+        support.extremeAll(directions, results, 4);
+        ASSERT_EQ(directions.getSize(), results.size());
+        for (unsigned i = 0; i < dirs.size(); i++) {
+            double best = -INFINITY;
+            for (auto& pt : data) {
+                best = std::max(best, pt[0] * dirs[i][0] + pt[1] * dirs[i][1]);
+            }
+            EXPECT_EQ(support.extreme(dirs[i][0], dirs[i][1]), results[i]);
+            EXPECT_NEAR(best, support.support(dirs[i][0], dirs[i][1]),
+                        1e-9 * 100000);
+        }
+    }
+}
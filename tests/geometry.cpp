@@ -1,6 +1,11 @@
 #include <gtest/gtest.h>
 
 #include "lib/geometry.h"
+#include "lib/generator.h"
+#include "solvers/monotone_chain_2d.h"
+#include "solvers/hull_analytics_2d.h"
+#include "solvers/hull_query_2d.h"
+#include "solvers/convex_ops_2d.h"
 
 TEST(GeometryTest, PointToLine)
 {
@@ -8,3 +13,226 @@ TEST(GeometryTest, PointToLine)
     EXPECT_DOUBLE_EQ(sqrt(0.5), ch::distToLine({0, 0}, {1, 1}, {0, 1}));
     EXPECT_DOUBLE_EQ(0.0, ch::distToLine({0, 0}, {2, 2}, {1, 1}));
 }
+
+TEST(GeometryTest, PointInHull)
+{
+    ch::Generator2D generator;
+    ch::MonotoneChain2D solver;
+    for (long long h : {3, 4, 34, 1000}) {
+        ch::Points2D points, hull;
+        generator.genRandomCircle(5000, h, 1000, points);
+        solver.solve(points, hull);
+        std::vector<double> hx, hy;
+        for (auto& pt : hull.getData()) {
+            hx.push_back(pt[0]);
+            hy.push_back(pt[1]);
+        }
+        int k = hx.size();
+
+        // vertices lie on border, other points are compared to edge tests
+        for (int i = 0; i < k; i++) {
+            EXPECT_FALSE(ch::ptInHull(hx.data(), hy.data(), k, hx[i], hy[i]));
+        }
+        for (auto& pt : points.getData()) {
+            bool inside = true;
+            for (int i = 0; i < k; i++) {
+                int j = (i + 1) % k;
+                if (ch::cross(hx[i], hy[i], hx[j], hy[j], pt[0], pt[1])
+                    > -ch::EPS) {
+                    inside = false;
+                }
+            }
+            EXPECT_EQ(inside,
+                      ch::ptInHull(hx.data(), hy.data(), k, pt[0], pt[1]));
+        }
+    }
+}
+
+TEST(HullAnalytics2DTest, Measures)
+{
+    // square rotated by 45 degrees, with its left corner cut off
+    ch::Points2D hull;
+    hull.add({0, 2});
+    hull.add({2, 0});
+    hull.add({0, -2});
+    hull.add({-1, -1});
+    hull.add({-1, 1});
+    ch::HullAnalytics2D analytics(hull);
+
+    EXPECT_DOUBLE_EQ(7.0, analytics.area());
+    EXPECT_DOUBLE_EQ(6 * sqrt(2.0) + 2, analytics.perimeter());
+    ch::point2d_t c = analytics.centroid(), a, b, normal;
+    EXPECT_NEAR(4.0 / 21, c.first, 1e-12);
+    EXPECT_NEAR(0.0, c.second, 1e-12);
+    EXPECT_DOUBLE_EQ(4.0, analytics.diameter(a, b));
+    EXPECT_DOUBLE_EQ(0.0, a.first + b.first);
+    EXPECT_DOUBLE_EQ(2 * sqrt(2.0), analytics.width(normal));
+    EXPECT_DOUBLE_EQ(sqrt(0.5), fabs(normal.first));
+
+    ch::HullAnalytics2D::Rectangle
+        area = analytics.minAreaRectangle(),
+        perimeter = analytics.minPerimeterRectangle();
+    EXPECT_NEAR(8.0, area.area, 1e-9);
+    EXPECT_NEAR(8 * sqrt(2.0), perimeter.perimeter, 1e-9);
+    EXPECT_NEAR(2.0, fabs(area.corners[0].first + area.corners[0].second),
+                1e-9);
+
+    ch::Points2D segment;
+    segment.add({1, 1});
+    segment.add({4, 5});
+    ch::HullAnalytics2D line(segment);
+    EXPECT_DOUBLE_EQ(0.0, line.area());
+    EXPECT_DOUBLE_EQ(10.0, line.perimeter());
+    EXPECT_DOUBLE_EQ(5.0, line.diameter(a, b));
+    EXPECT_DOUBLE_EQ(2.5, line.centroid().first);
+    EXPECT_DOUBLE_EQ(0.0, line.width(normal));
+    EXPECT_DOUBLE_EQ(0.0, line.minAreaRectangle().area);
+}
+
+TEST(HullAnalytics2DTest, Generated)
+{
+    ch::Generator2D generator;
+    for (long long h : {3, 17, 500}) {
+        ch::Points2D points, hull;
+        generator.genUniformCircle(5000, h, 100000, points);
+        ch::MonotoneChain2D solver;
+        solver.solve(points, hull);
+        ch::HullAnalytics2D analytics(hull);
+        const ch::data_t& data = hull.getData();
+        unsigned k = data.size();
+
+        // brute force over pairs of vertices and over edges
+        double diameter = 0, width = INFINITY, area = INFINITY,
+               perimeter = INFINITY;
+        for (unsigned i = 0; i < k; i++) {
+            const std::vector<double>& p = data[i], & q = data[(i + 1) % k];
+            double len = ch::dist(p[0], p[1], q[0], q[1]),
+                   ux = (q[0] - p[0]) / len, uy = (q[1] - p[1]) / len,
+                   lo = INFINITY, hi = -INFINITY, far = 0;
+            for (unsigned j = 0; j < k; j++) {
+                const std::vector<double>& r = data[j];
+                diameter = std::max(diameter,
+                                    ch::dist(p[0], p[1], r[0], r[1]));
+                double along = r[0] * ux + r[1] * uy,
+                       across = fabs((r[0] - p[0]) * uy - (r[1] - p[1]) * ux);
+                lo = std::min(lo, along);
+                hi = std::max(hi, along);
+                far = std::max(far, across);
+            }
+            width = std::min(width, far);
+            area = std::min(area, (hi - lo) * far);
+            perimeter = std::min(perimeter, 2 * (hi - lo + far));
+        }
+
+        ch::point2d_t a, b, normal;
+        double tol = 1e-9 * diameter * diameter;
+        EXPECT_NEAR(diameter, analytics.diameter(a, b), 1e-9 * diameter);
+        EXPECT_NEAR(width, analytics.width(normal), 1e-9 * diameter);
+        EXPECT_NEAR(area, analytics.minAreaRectangle().area, tol);
+        EXPECT_NEAR(perimeter, analytics.minPerimeterRectangle().perimeter,
+                    1e-9 * diameter);
+        EXPECT_GT(analytics.area(), 0);
+    }
+}
+
+TEST(ConvexOps2DTest, Squares)
+{
+    // squares in output order, second one shifted by (1, 1)
+    ch::Points2D a, b, segment, output;
+    for (double s : {0.0, 1.0}) {
+        ch::Points2D& square = s ? b : a;
+        square.add({s, s});
+        square.add({s, s + 2});
+        square.add({s + 2, s + 2});
+        square.add({s + 2, s});
+    }
+
+    ch::ConvexOps2D::intersect(a, b, output);
+    ch::data_t expected = {{1, 1}, {1, 2}, {2, 2}, {2, 1}};
+    EXPECT_EQ(expected, output.getData());
+
+    output.clear();
+    ch::ConvexOps2D::minkowskiSum(a, b, output);
+    expected = {{1, 1}, {1, 5}, {5, 5}, {5, 1}};
+    EXPECT_EQ(expected, output.getData());
+
+    output.clear();
+    ch::ConvexOps2D::unite(a, b, output);
+    expected = {{0, 0}, {0, 2}, {1, 3}, {3, 3}, {3, 1}, {2, 0}};
+    EXPECT_EQ(expected, output.getData());
+
+    // segment crossing the square, and disjoint squares
+    segment.add({-1, 1});
+    segment.add({5, 1});
+    output.clear();
+    ch::ConvexOps2D::intersect(segment, a, output);
+    ASSERT_EQ(2U, output.getSize());
+    EXPECT_NEAR(0.0, output.getData()[0][0], 1e-12);
+    EXPECT_NEAR(2.0, output.getData()[1][0], 1e-12);
+
+    ch::Points2D far;
+    for (auto& pt : b.getData()) {
+        far.add({pt[0] + 5, pt[1]});
+    }
+    output.clear();
+    ch::ConvexOps2D::intersect(a, far, output);
+    EXPECT_EQ(0U, output.getSize());
+}
+
+TEST(ConvexOps2DTest, Generated)
+{
+    ch::Generator2D generator;
+    std::vector<ch::Points2D> as, bs, sums, unions, meets;
+    for (long long h : {3, 20, 300}) {
+        ch::Points2D points, hull;
+        generator.genUniformCircle(2000, h, 100000, points);
+        ch::MonotoneChain2D solver;
+        solver.solve(points, hull);
+        as.push_back(hull);
+        ch::Points2D shifted, shiftedHull;
+        for (auto& pt : points.getData()) {
+            shifted.add({pt[0] / 2 + 60000, pt[1] / 3 - 20000});
+        }
+        solver.solve(shifted, shiftedHull);
+        bs.push_back(shiftedHull);
+    }
+    ch::ConvexOps2D::applyAll(ch::ConvexOps2D::SUM, as, bs, sums, 2);
+    ch::ConvexOps2D::applyAll(ch::ConvexOps2D::UNION, as, bs, unions, 2);
+    ch::ConvexOps2D::applyAll(ch::ConvexOps2D::INTERSECTION, as, bs, meets,
+                              2);
+    ASSERT_EQ(as.size(), sums.size());
+
+    for (unsigned i = 0; i < as.size(); i++) {
+        // sum and union against hull of all sums and of both vertex sets
+        ch::Points2D pairs, both(as[i]), expected;
+        for (auto& p : as[i].getData()) {
+            for (auto& q : bs[i].getData()) {
+                pairs.add({p[0] + q[0], p[1] + q[1]});
+            }
+        }
+        ch::MonotoneChain2D solver;
+        solver.solve(pairs, expected);
+        EXPECT_NEAR(ch::HullAnalytics2D(expected).area(),
+                    ch::HullAnalytics2D(sums[i]).area(), 1e-3);
+        for (auto& q : bs[i].getData()) {
+            both.add(q);
+        }
+        expected.clear();
+        solver.solve(both, expected);
+        ch::data_t sorted = expected.getData(), united = unions[i].getData();
+        std::sort(sorted.begin(), sorted.end());
+        std::sort(united.begin(), united.end());
+        EXPECT_EQ(sorted, united);
+
+        // intersection lies in both hulls, its area fits into theirs
+        ASSERT_GE(meets[i].getSize(), 3U);
+        ch::HullQuery2D inA(as[i]), inB(bs[i]);
+        for (auto& pt : meets[i].getData()) {
+            EXPECT_NE(ch::HullQuery2D::OUTSIDE, inA.locate(pt[0], pt[1]));
+            EXPECT_NE(ch::HullQuery2D::OUTSIDE, inB.locate(pt[0], pt[1]));
+        }
+        double area = ch::HullAnalytics2D(meets[i]).area();
+        EXPECT_GT(area, 0);
+        EXPECT_LE(area, ch::HullAnalytics2D(bs[i]).area());
+    }
+}
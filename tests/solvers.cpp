@@ -3,6 +3,8 @@
 #include <iostream>
 #include <iomanip>
 #include <fstream>
+#include <random>
+#include <algorithm>
 
 #include "lib/structures.h"
 #include "lib/generator.h"
@@ -11,7 +13,16 @@
 #include "solvers/monotone_chain_2d.h"
 #include "solvers/quickhull_2d.h"
 #include "solvers/chan_2d.h"
+#include "solvers/ouellet_2d.h"
 #include "solvers/jarvis_scan_3d.h"
+#include "solvers/kirkpatrick_seidel_2d.h"
+#include "solvers/divide_conquer_2d.h"
+#include "solvers/randomized_incremental_2d.h"
+#include "solvers/sample_filter_2d.h"
+#include "solvers/small_hull_2d.h"
+#include "solvers/convex_layers_2d.h"
+#include "solvers/hull_analytics_2d.h"
+#include "solvers/kinetic_hull_2d.h"
 
 void printHull2D(ch::Points2D& points, std::ostream& out)
 {
@@ -159,13 +170,410 @@ TEST(Chan2DTest, Premade)
     testSolverPremade2D(chan);
 }
 
-/*
 TEST(Chan2DTest, Generated)
 {
     ch::Chan2D chan;
     testSolverGen2D(chan);
 }
-*/
+
+TEST(Ouellet2DTest, Premade)
+{
+    ch::Ouellet2D ouellet;
+    testSolverPremade2D(ouellet);
+}
+
+TEST(Ouellet2DTest, Generated)
+{
+    ch::Ouellet2D ouellet;
+    testSolverGen2D(ouellet);
+}
+
+TEST(KirkpatrickSeidel2DTest, Premade)
+{
+    ch::KirkpatrickSeidel2D kirkpatrick;
+    testSolverPremade2D(kirkpatrick);
+}
+
+TEST(KirkpatrickSeidel2DTest, Generated)
+{
+    ch::KirkpatrickSeidel2D kirkpatrick;
+    testSolverGen2D(kirkpatrick);
+}
+
+TEST(DivideConquer2DTest, Premade)
+{
+    ch::DivideConquer2D divide(3);
+    testSolverPremade2D(divide);
+}
+
+TEST(DivideConquer2DTest, Generated)
+{
+    ch::DivideConquer2D divide(8);
+    testSolverGen2D(divide);
+}
+
+TEST(RandomizedIncremental2DTest, Premade)
+{
+    ch::RandomizedIncremental2D randomized;
+    testSolverPremade2D(randomized);
+}
+
+TEST(RandomizedIncremental2DTest, Generated)
+{
+    ch::RandomizedIncremental2D randomized(42);
+    testSolverGen2D(randomized);
+}
+
+TEST(SampleFilter2DTest, Premade)
+{
+    ch::SampleFilter2D sample(ch::SampleFilter2D::PARA);
+    testSolverPremade2D(sample);
+}
+
+TEST(SampleFilter2DTest, Generated)
+{
+    ch::SampleFilter2D sample(ch::SampleFilter2D::PARA);
+    testSolverGen2D(sample);
+}
+
+TEST(SmallHull2DTest, Premade)
+{
+    ch::SmallHull2D small;
+    testSolverPremade2D(small);
+}
+
+TEST(SmallHull2DTest, Generated)
+{
+    ch::SmallHull2D small;
+    testSolverGen2D(small);
+}
+
+TEST(Solver2DTest, OutputOrder)
+{
+    // tiny kernel below 33 points, solver itself above, same order
+    ch::Generator2D generator;
+    ch::JarvisScan2D jarvis, jarvisCross(ch::JarvisScan2D::CROSS),
+                     jarvisPolar(ch::JarvisScan2D::POLAR);
+    ch::GrahamScan2D graham;
+    ch::MonotoneChain2D monotone;
+    ch::Quickhull2D quickhull, quickNaive(ch::Quickhull2D::NAIVE),
+                    quickPara(ch::Quickhull2D::PARA);
+    ch::Chan2D chan;
+    ch::Ouellet2D ouellet;
+    ch::KirkpatrickSeidel2D kirkpatrick;
+    ch::DivideConquer2D divide;
+    ch::RandomizedIncremental2D incremental;
+    ch::SampleFilter2D filter;
+    ch::SmallHull2D small;
+    ch::KineticHull2D kinetic;
+    std::vector<ch::Points2D> inputs(3);
+    generator.genRandomCircle(32, 10, 1000, inputs[0]);
+    generator.genRandomCircle(33, 10, 1000, inputs[1]);
+    // grid has vertical edges, its smallest point ends chains of many solvers
+    for (int x = 0; x < 7; x++) {
+        for (int y = 0; y < 7; y++) {
+            inputs[2].add({(double) x, (double) y});
+        }
+    }
+    std::vector<unsigned> sizes = {10, 10, 4};
+    for (unsigned k = 0; k < inputs.size(); k++) {
+        for (ch::Solver2D* solver : std::vector<ch::Solver2D*>{&jarvis,
+                 &jarvisCross, &jarvisPolar, &graham, &monotone, &quickhull,
+                 &quickNaive, &quickPara, &chan, &ouellet, &kirkpatrick,
+                 &divide, &incremental, &filter, &small, &kinetic}) {
+            ch::Points2D output;
+            solver->solve(inputs[k], output);
+            const ch::data_t& data = output.getData();
+            unsigned h = sizes[k];
+            ASSERT_EQ(h, data.size()) << solver->getName() << " " << k;
+            EXPECT_EQ(*std::min_element(data.begin(), data.end()), data[0])
+                << solver->getName() << " " << k;
+            for (unsigned i = 0; i < h; i++) {
+                const ch::point_t& a = data[i], & b = data[(i + 1) % h],
+                                 & c = data[(i + 2) % h];
+                EXPECT_LT(ch::cross(a[0], a[1], b[0], b[1], c[0], c[1]), 0)
+                    << solver->getName() << " " << k;
+            }
+        }
+    }
+}
+
+TEST(HullStats2DTest, AllSolvers)
+{
+    ch::Generator2D generator;
+    std::vector<ch::Points2D> inputs(3);
+    ASSERT_TRUE(readFile("tests/files/basic1.in", inputs[0]));
+    generator.genUniformCircle(10000, 100, 1000, inputs[1]);
+    generator.genRandomCircle(100000, 1000, 100000, inputs[2]);
+
+    ch::JarvisScan2D jarvis;
+    ch::GrahamScan2D graham;
+    ch::MonotoneChain2D monotone;
+    ch::Quickhull2D quickhull;
+    ch::Chan2D chan;
+    ch::Ouellet2D ouellet;
+    ch::KirkpatrickSeidel2D kirkpatrick;
+    ch::DivideConquer2D divide;
+    ch::RandomizedIncremental2D incremental;
+    ch::SampleFilter2D filter;
+    ch::SmallHull2D small;
+    for (ch::Solver2D* solver : std::vector<ch::Solver2D*>{&jarvis, &graham,
+             &monotone, &quickhull, &chan, &ouellet, &kirkpatrick, &divide,
+             &incremental, &filter, &small}) {
+        solver->setStats(true);
+        for (auto& input : inputs) {
+            ch::Points2D output;
+            solver->solve(input, output);
+            ch::HullStats stats = solver->getStats();
+            ch::HullAnalytics2D analytics(output);
+            double tol = 1e-9 * analytics.perimeter();
+            EXPECT_NEAR(analytics.area(), stats.area, 1e-9 * analytics.area());
+            EXPECT_NEAR(analytics.perimeter(), stats.perimeter, tol);
+            EXPECT_NEAR(analytics.centroid().first, stats.centroid.first, tol);
+            EXPECT_NEAR(analytics.centroid().second, stats.centroid.second,
+                        tol);
+
+            double minX = INFINITY, maxY = -INFINITY;
+            for (auto& pt : output.getData()) {
+                minX = std::min(minX, pt[0]);
+                maxY = std::max(maxY, pt[1]);
+            }
+            EXPECT_EQ(minX, stats.min.first);
+            EXPECT_EQ(maxY, stats.max.second);
+        }
+    }
+}
+
+TEST(HullChain2DTest, Partial)
+{
+    ch::Generator2D generator;
+    std::vector<ch::Points2D> inputs(5);
+    ASSERT_TRUE(readFile("tests/files/basic1.in", inputs[0]));
+    for (int x = 0; x < 5; x++) {
+        for (int y = 0; y < 50; y++) {
+            inputs[1].add({(double) x, (double) y});
+        }
+    }
+    generator.genRandomCircle(20000, 200, 1000, inputs[2]);
+
+    // grids by rows and shuffled, ties of farthest points lie inside edges
+    std::vector<ch::point_t> grid;
+    for (int y = 0; y < 40; y++) {
+        for (int x = 0; x < 40; x++) {
+            grid.push_back({(double) x, (double) y});
+        }
+    }
+    for (auto& pt : grid) {
+        inputs[3].add(pt);
+    }
+    std::shuffle(grid.begin(), grid.end(), std::mt19937(7));
+    for (auto& pt : grid) {
+        inputs[4].add(pt);
+    }
+
+    std::vector<ch::HullChain2D> chains = {
+        ch::HullChain2D(ch::HullChain2D::UPPER),
+        ch::HullChain2D(ch::HullChain2D::LOWER),
+        ch::HullChain2D(0, 1, 1, 0),
+        ch::HullChain2D(1, 0, 0.3, 1),
+        ch::HullChain2D(1, 1, 1, 1)};
+
+    ch::Quickhull2D quickForward, quickPara(ch::Quickhull2D::PARA);
+    ch::MonotoneChain2D monotone;
+    ch::JarvisScan2D jarvisPara, jarvisCross(ch::JarvisScan2D::CROSS);
+    for (auto& input : inputs) {
+        ch::Points2D full, upper, lower;
+        ch::MonotoneChain2D().solve(input, full);
+
+        // upper and lower chains end at leftmost and rightmost points,
+        // vertical edges there belong to both
+        chains[0].cut(full, upper);
+        chains[1].cut(full, lower);
+        double minX = INFINITY, maxX = -INFINITY;
+        for (auto& pt : full.getData()) {
+            minX = std::min(minX, pt[0]);
+            maxX = std::max(maxX, pt[0]);
+        }
+        EXPECT_EQ(minX, upper.getData().front()[0]);
+        EXPECT_EQ(maxX, upper.getData().back()[0]);
+        EXPECT_EQ(maxX, lower.getData().front()[0]);
+        EXPECT_EQ(minX, lower.getData().back()[0]);
+        if (&input == &inputs[2]) {
+            EXPECT_EQ(full.getSize() + 2, upper.getSize() + lower.getSize());
+        }
+
+        for (auto& chain : chains) {
+            ch::Points2D expected;
+            chain.cut(full, expected);
+            quickForward.setChain(chain);
+            quickPara.setChain(chain);
+            monotone.setChain(chain);
+            jarvisPara.setChain(chain);
+            jarvisCross.setChain(chain);
+            for (ch::Solver2D* solver : std::vector<ch::Solver2D*>{
+                     &quickForward, &quickPara, &monotone, &jarvisPara,
+                     &jarvisCross}) {
+                ch::Points2D output;
+                solver->solve(input, output);
+                EXPECT_EQ(expected.getData(), output.getData())
+                    << solver->getName();
+            }
+        }
+    }
+}
+
+TEST(HullChain2DTest, SplitOnEdge)
+{
+    // sweep is split at direction perpendicular to long edge full of
+    // points, split point has to be one of edge ends
+    std::mt19937 rng(3);
+    ch::Points2D input;
+    for (int i = 0; i < 2000; i++) {
+        double v = 28 + rng() % 99891;
+        input.add({v, v});
+    }
+    input.add({28, 28});
+    input.add({99918, 99918});
+    input.add({99965, 199930});
+    double from = 65 * M_PI / 180, to = 205 * M_PI / 180;
+    ch::HullChain2D chain(cos(from), sin(from), cos(to), sin(to));
+
+    ch::Points2D full, expected;
+    ch::MonotoneChain2D().solve(input, full);
+    chain.cut(full, expected);
+    ASSERT_EQ(3U, expected.getSize());
+    EXPECT_EQ(ch::point_t({99965, 199930}), expected.getData()[0]);
+    EXPECT_EQ(ch::point_t({99918, 99918}), expected.getData()[1]);
+    EXPECT_EQ(ch::point_t({28, 28}), expected.getData()[2]);
+
+    ch::JarvisScan2D jarvis;
+    ch::Quickhull2D quickhull;
+    jarvis.setChain(chain);
+    quickhull.setChain(chain);
+    for (ch::Solver2D* solver : std::vector<ch::Solver2D*>{&jarvis,
+                                                           &quickhull}) {
+        ch::Points2D output;
+        solver->solve(input, output);
+        EXPECT_EQ(expected.getData(), output.getData()) << solver->getName();
+    }
+}
+
+/** Depths by peeling hull with points on edges again and again */
+std::vector<unsigned> naiveDepths(const ch::Points2D& points)
+{
+    const ch::data_t& data = points.getData();
+    std::vector<unsigned> left(data.size()), depths(data.size());
+    for (unsigned i = 0; i < left.size(); i++) {
+        left[i] = i;
+    }
+    std::sort(left.begin(), left.end(), [&](unsigned a, unsigned b) {
+        return data[a] < data[b];
+    });
+    auto turn = [&](unsigned a, unsigned b, unsigned c) {
+        return ch::cross(data[a][0], data[a][1], data[b][0], data[b][1],
+                         data[c][0], data[c][1]);
+    };
+    for (unsigned depth = 0; !left.empty(); depth++) {
+        std::vector<unsigned> upper, lower, rest;
+        for (auto i : left) {
+            while (upper.size() >= 2
+                   && turn(upper[upper.size() - 2], upper.back(), i)
+                      > ch::EPS) {
+                upper.pop_back();
+            }
+            upper.push_back(i);
+            while (lower.size() >= 2
+                   && turn(lower[lower.size() - 2], lower.back(), i)
+                      < -ch::EPS) {
+                lower.pop_back();
+            }
+            lower.push_back(i);
+        }
+        std::vector<bool> on(data.size(), false);
+        for (auto chain : {&upper, &lower}) {
+            for (auto i : *chain) {
+                on[i] = true;
+            }
+        }
+        for (auto i : left) {
+            if (on[i]) {
+                depths[i] = depth;
+            } else {
+                rest.push_back(i);
+            }
+        }
+        left.swap(rest);
+    }
+    return depths;
+}
+
+TEST(ConvexLayers2DTest, Grid)
+{
+    // 5 x 5 grid, layers keep points on edges
+    ch::Points2D input;
+    for (int x = 0; x < 5; x++) {
+        for (int y = 0; y < 5; y++) {
+            input.add({(double) x, (double) y});
+        }
+    }
+    ch::ConvexLayers2D layers;
+    std::vector<ch::Points2D> output;
+    layers.solve(input, output);
+    ASSERT_EQ(3U, output.size());
+    EXPECT_EQ(16U, output[0].getSize());
+    EXPECT_EQ(8U, output[1].getSize());
+    EXPECT_EQ(1U, output[2].getSize());
+    EXPECT_EQ(0U, layers.getDepths()[0]);
+    EXPECT_EQ(2U, layers.getDepths()[12]);
+
+    // doubled grid peels the same, copies share depth
+    for (int x = 0; x < 5; x++) {
+        for (int y = 0; y < 5; y++) {
+            input.add({(double) x, (double) y});
+        }
+    }
+    output.clear();
+    layers.solve(input, output);
+    ASSERT_EQ(3U, output.size());
+    EXPECT_EQ(16U, output[0].getSize());
+    EXPECT_EQ(8U, output[1].getSize());
+    EXPECT_EQ(1U, output[2].getSize());
+    EXPECT_EQ(2U, layers.getDepths()[12]);
+    EXPECT_EQ(2U, layers.getDepths()[37]);
+    EXPECT_EQ(1U, layers.getDepths()[31]);
+
+    // square with repeated inner point
+    ch::Points2D square;
+    for (auto& pt : std::vector<ch::point_t>{{0, 0}, {0, 4}, {4, 4}, {4, 0},
+                                             {2, 2}, {2, 2}}) {
+        square.add(pt);
+    }
+    output.clear();
+    layers.solve(square, output);
+    ASSERT_EQ(2U, output.size());
+    EXPECT_EQ(4U, output[0].getSize());
+    EXPECT_EQ(1U, output[1].getSize());
+    EXPECT_EQ(1U, layers.getDepths()[4]);
+    EXPECT_EQ(1U, layers.getDepths()[5]);
+}
+
+TEST(ConvexLayers2DTest, Generated)
+{
+    ch::Generator2D generator;
+    ch::Points2D input;
+    generator.genUniformCircle(20000, 50, 1000, input);
+    std::vector<unsigned> expected = naiveDepths(input);
+
+    for (auto v : {ch::ConvexLayers2D::SEQ, ch::ConvexLayers2D::PARA}) {
+        ch::ConvexLayers2D layers(v);
+        std::vector<ch::Points2D> output;
+        layers.solve(input, output);
+        EXPECT_EQ(expected, layers.getDepths());
+        EXPECT_EQ(*std::max_element(expected.begin(), expected.end()) + 1,
+                  output.size());
+        EXPECT_EQ(50U, output[0].getSize());
+    }
+}
 
 /*
 TEST(PrintHull, EraseMe)